@@ -0,0 +1,355 @@
+using UnityEngine;
+using UnityEngine.Audio;
+
+public enum AudioCategory
+{
+    UI,
+    Interaction, // Pickups, item use, puzzles
+    Ambient,
+    Music,
+    Dialogue
+}
+
+[System.Serializable]
+public class AudioCategorySettings
+{
+    public AudioCategory category;
+    public string mixerGroup;  // MainAudioMixer group name (matched case-insensitively)
+    public int maxVoices;
+    [Range(0f, 1f)] public float spatialBlend;
+
+    public AudioCategorySettings(AudioCategory category, string mixerGroup, int maxVoices, float spatialBlend = 0f)
+    {
+        this.category = category;
+        this.mixerGroup = mixerGroup;
+        this.maxVoices = maxVoices;
+        this.spatialBlend = spatialBlend;
+    }
+}
+
+// Fixed pool of AudioSources created up front and routed to MainAudioMixer groups.
+// Each category has a voice limit; when it (or the whole pool) is full, the least
+// important voice is stolen, oldest first. Priority follows AudioSource.priority:
+// 0 is most important, 256 least.
+public class AudioVoiceManager : PersistentSingleton<AudioVoiceManager>
+{
+    [Header("Pool")]
+    public int voiceCount = 16;
+
+    [Header("Categories")]
+    public AudioCategorySettings[] categories =
+    {
+        new AudioCategorySettings(AudioCategory.UI, "SFX", 3),
+        new AudioCategorySettings(AudioCategory.Interaction, "SFX", 6),
+        new AudioCategorySettings(AudioCategory.Ambient, "SFX", 4),
+        new AudioCategorySettings(AudioCategory.Music, "Music", 2),
+        new AudioCategorySettings(AudioCategory.Dialogue, "Dialogue", 2)
+    };
+
+    [Header("Mixer")]
+    public AudioMixer mixer; // Found by name if left empty
+
+    [Header("Debug")]
+    public bool logSteals = false;
+
+    struct Voice
+    {
+        public AudioSource source;
+        public int category;
+        public int priority;
+        public float startTime;
+        public float volume; // Requested volume before the category volume
+    }
+
+    private Voice[] voices;
+    private AudioMixerGroup[] mixerGroups;
+    private AudioCategorySettings[] settingsByCategory;
+    private float[] categoryVolumes;
+
+    // Systems that own their own sources scale by this and re-apply on change
+    public static event System.Action<AudioCategory, float> OnCategoryVolumeChanged;
+
+    public int StolenVoices { get; private set; }
+    public int DroppedSounds { get; private set; }
+
+    protected override void OnSingletonAwake()
+    {
+        int categoryCount = System.Enum.GetValues(typeof(AudioCategory)).Length;
+        settingsByCategory = new AudioCategorySettings[categoryCount];
+        categoryVolumes = new float[categoryCount];
+
+        for (int i = 0; i < categoryCount; i++)
+        {
+            settingsByCategory[i] = new AudioCategorySettings((AudioCategory)i, "SFX", voiceCount);
+            categoryVolumes[i] = 1f;
+        }
+
+        foreach (AudioCategorySettings settings in categories)
+        {
+            settingsByCategory[(int)settings.category] = settings;
+        }
+
+        CreateVoices();
+
+        if (mixer == null)
+            mixer = FindMainMixer();
+        RouteVoices();
+    }
+
+    void CreateVoices()
+    {
+        voices = new Voice[voiceCount];
+
+        for (int i = 0; i < voiceCount; i++)
+        {
+            GameObject voiceObj = new GameObject("Voice " + i);
+            voiceObj.transform.SetParent(transform, false);
+
+            AudioSource source = voiceObj.AddComponent<AudioSource>();
+            source.playOnAwake = false;
+            source.loop = false;
+
+            voices[i].source = source;
+            voices[i].category = -1;
+        }
+    }
+
+    // Loaded mixers only; the scene's PauseMenuManager keeps MainAudioMixer in memory
+    static AudioMixer FindMainMixer()
+    {
+        foreach (AudioMixer candidate in Resources.FindObjectsOfTypeAll<AudioMixer>())
+        {
+            if (candidate.name == "MainAudioMixer")
+                return candidate;
+        }
+
+        Debug.LogWarning("[AudioVoiceManager] MainAudioMixer not loaded - voices play unrouted");
+        return null;
+    }
+
+    public void SetMixer(AudioMixer audioMixer)
+    {
+        if (audioMixer == null || audioMixer == mixer) return;
+
+        mixer = audioMixer;
+        RouteVoices();
+    }
+
+    void RouteVoices()
+    {
+        if (mixer == null) return;
+
+        // Setup only; FindMatchingGroups allocates
+        mixerGroups = mixer.FindMatchingGroups(string.Empty);
+
+        for (int i = 0; i < voices.Length; i++)
+        {
+            if (voices[i].category >= 0)
+                voices[i].source.outputAudioMixerGroup = FindGroup(mixerGroups, settingsByCategory[voices[i].category].mixerGroup);
+        }
+    }
+
+    // For systems that own their own sources (streamed music/ambience loops)
+    public AudioMixerGroup GetMixerGroup(AudioCategory category)
+    {
+        return FindGroup(mixerGroups, settingsByCategory[(int)category].mixerGroup);
+    }
+
+    // The asset spells its dialogue group "DIalogue"
+    static AudioMixerGroup FindGroup(AudioMixerGroup[] groups, string groupName)
+    {
+        if (groups == null) return null;
+
+        foreach (AudioMixerGroup group in groups)
+        {
+            if (string.Equals(group.name, groupName, System.StringComparison.OrdinalIgnoreCase))
+                return group;
+        }
+        return null;
+    }
+
+    // Returns false when every candidate voice is more important than this sound
+    public bool Play(AudioClip clip, AudioCategory category, float volume = 1f, int priority = 128)
+    {
+        return StartVoice(clip, category, volume, priority, 1f) >= 0;
+    }
+
+    public bool Play(AudioClip clip, AudioCategory category, float volume, int priority, float pitch)
+    {
+        return StartVoice(clip, category, volume, priority, pitch) >= 0;
+    }
+
+    public bool PlayAt(AudioClip clip, AudioCategory category, Vector3 position, float volume = 1f, int priority = 128)
+    {
+        int voiceIndex = StartVoice(clip, category, volume, priority, 1f);
+        if (voiceIndex < 0) return false;
+
+        voices[voiceIndex].source.transform.position = position;
+        return true;
+    }
+
+    int StartVoice(AudioClip clip, AudioCategory category, float volume, int priority, float pitch)
+    {
+        if (clip == null) return -1;
+
+        int categoryIndex = (int)category;
+        int voiceIndex = AcquireVoice(categoryIndex, priority);
+        if (voiceIndex < 0)
+        {
+            DroppedSounds++;
+            return -1;
+        }
+
+        AudioCategorySettings settings = settingsByCategory[categoryIndex];
+        ref Voice voice = ref voices[voiceIndex];
+        AudioSource source = voice.source;
+
+        // Only re-route when the voice changes category
+        if (voice.category != categoryIndex)
+        {
+            source.outputAudioMixerGroup = FindGroup(mixerGroups, settings.mixerGroup);
+            source.spatialBlend = settings.spatialBlend;
+        }
+
+        voice.category = categoryIndex;
+        voice.priority = priority;
+        voice.startTime = Time.unscaledTime;
+        voice.volume = volume;
+
+        source.Stop();
+        source.clip = clip;
+        source.priority = priority;
+        source.pitch = pitch;
+        source.volume = volume * categoryVolumes[categoryIndex];
+        source.Play();
+
+        return voiceIndex;
+    }
+
+    int AcquireVoice(int categoryIndex, int priority)
+    {
+        int activeInCategory = 0;
+        int freeVoice = -1;
+
+        for (int i = 0; i < voices.Length; i++)
+        {
+            if (voices[i].source.isPlaying)
+            {
+                if (voices[i].category == categoryIndex)
+                    activeInCategory++;
+            }
+            else if (freeVoice < 0 || voices[i].category == categoryIndex)
+            {
+                // Prefer an idle voice already routed to this category
+                freeVoice = i;
+            }
+        }
+
+        // Category at its limit: steal within the category
+        if (activeInCategory >= settingsByCategory[categoryIndex].maxVoices)
+            return StealVoice(categoryIndex, priority);
+
+        if (freeVoice >= 0)
+            return freeVoice;
+
+        // Pool exhausted: steal from anyone
+        return StealVoice(-1, priority);
+    }
+
+    int StealVoice(int categoryIndex, int priority)
+    {
+        int candidate = -1;
+
+        for (int i = 0; i < voices.Length; i++)
+        {
+            if (categoryIndex >= 0 && voices[i].category != categoryIndex) continue;
+            if (!voices[i].source.isPlaying) continue;
+
+            if (candidate < 0 ||
+                voices[i].priority > voices[candidate].priority ||
+                (voices[i].priority == voices[candidate].priority && voices[i].startTime < voices[candidate].startTime))
+            {
+                candidate = i;
+            }
+        }
+
+        // Never cut off something more important than the new sound
+        if (candidate < 0 || voices[candidate].priority < priority)
+            return -1;
+
+        StolenVoices++;
+        if (logSteals)
+            Debug.Log($"[AudioVoiceManager] Stole {(AudioCategory)voices[candidate].category} voice playing {voices[candidate].source.clip.name}");
+
+        return candidate;
+    }
+
+    public void StopCategory(AudioCategory category)
+    {
+        int categoryIndex = (int)category;
+        for (int i = 0; i < voices.Length; i++)
+        {
+            if (voices[i].category == categoryIndex)
+                voices[i].source.Stop();
+        }
+    }
+
+    // 0..1, applied on top of the mixer; playing voices follow immediately
+    public void SetCategoryVolume(AudioCategory category, float volume)
+    {
+        int categoryIndex = (int)category;
+        categoryVolumes[categoryIndex] = volume;
+
+        for (int i = 0; i < voices.Length; i++)
+        {
+            if (voices[i].category == categoryIndex)
+                voices[i].source.volume = voices[i].volume * volume;
+        }
+
+        OnCategoryVolumeChanged?.Invoke(category, volume);
+    }
+
+    // 1 until the manager exists, so owners can call it without creating one
+    public static float CategoryVolume(AudioCategory category)
+    {
+        return HasInstance ? Instance.categoryVolumes[(int)category] : 1f;
+    }
+
+    // Every category routed to a mixer group, for settings sliders without a mixer.
+    // Covers the pooled voices and, through OnCategoryVolumeChanged, the music and room loops.
+    public void SetGroupVolume(string mixerGroup, float volume)
+    {
+        for (int i = 0; i < settingsByCategory.Length; i++)
+        {
+            if (string.Equals(settingsByCategory[i].mixerGroup, mixerGroup, System.StringComparison.OrdinalIgnoreCase))
+                SetCategoryVolume((AudioCategory)i, volume);
+        }
+    }
+
+    public int GetActiveVoiceCount(AudioCategory category)
+    {
+        int categoryIndex = (int)category;
+        int count = 0;
+        for (int i = 0; i < voices.Length; i++)
+        {
+            if (voices[i].category == categoryIndex && voices[i].source.isPlaying)
+                count++;
+        }
+        return count;
+    }
+
+    [ContextMenu("Log Voices")]
+    void LogVoices()
+    {
+        System.Text.StringBuilder report = new System.Text.StringBuilder();
+        report.Append($"[AudioVoiceManager] {voices.Length} voices, {StolenVoices} stolen, {DroppedSounds} dropped");
+
+        for (int i = 0; i < settingsByCategory.Length; i++)
+        {
+            AudioCategory category = (AudioCategory)i;
+            report.Append($"\n  {category}: {GetActiveVoiceCount(category)}/{settingsByCategory[i].maxVoices} -> {settingsByCategory[i].mixerGroup}");
+        }
+
+        Debug.Log(report.ToString());
+    }
+}
@@ -0,0 +1,168 @@
+using UnityEngine;
+
+// The lullaby as synchronized stems. Every stem is scheduled on the same DSP tick and
+// loops for as long as the music plays; collecting a memory fragment only ramps a
+// stem's volume up, so layers never re-seek or drift apart. Stems belong in
+// Assets/Audio/Music so they import as Streaming, and must all be the same length.
+public class LullabyMusic : MonoBehaviour
+{
+    [Header("Stems")]
+    public AudioClip[] stems = new AudioClip[0]; // Base melody first, then one per fragment
+    public bool baseLayerAlwaysOn = true;        // Stem 0 plays before any fragment is found
+    [Range(0f, 1f)] public float volume = 1f;
+
+    [Header("Timing")]
+    public float scheduleLead = 0.25f; // Seconds for every stream to buffer before the shared start
+    public float layerFadeTime = 1.5f;
+
+    [Header("Playback")]
+    public bool playOnStart = true;
+
+    private AudioSource[] sources;
+    private float[] layerVolumes;
+    private int audibleLayers;
+    private bool isPlaying = false;
+
+    public int AudibleLayers => audibleLayers;
+    public double StartDspTime { get; private set; }
+
+    void Awake()
+    {
+        sources = new AudioSource[stems.Length];
+        layerVolumes = new float[stems.Length];
+
+        int samples = -1;
+        for (int i = 0; i < stems.Length; i++)
+        {
+            GameObject stemObj = new GameObject("Stem " + i);
+            stemObj.transform.SetParent(transform, false);
+
+            AudioSource source = stemObj.AddComponent<AudioSource>();
+            source.playOnAwake = false;
+            source.loop = true;
+            source.clip = stems[i];
+            source.volume = 0f;
+            source.priority = 0;
+            source.spatialBlend = 0f;
+            sources[i] = source;
+
+            // Loops only stay aligned when every stem has the same sample count
+            if (stems[i] == null) continue;
+            if (samples >= 0 && stems[i].samples != samples)
+                Debug.LogWarning($"[LullabyMusic] Stem {i} ({stems[i].name}) is {stems[i].samples} samples, expected {samples} - layers will drift on loop");
+            samples = stems[i].samples;
+        }
+    }
+
+    void Start()
+    {
+        AudioVoiceManager voiceManager = AudioVoiceManager.Instance;
+        if (voiceManager != null)
+        {
+            foreach (AudioSource source in sources)
+                source.outputAudioMixerGroup = voiceManager.GetMixerGroup(AudioCategory.Music);
+        }
+
+        if (SaveSystem.Instance != null)
+        {
+            SaveSystem.Instance.OnLullabyProgressChanged += SetProgress;
+            SaveSystem.Instance.OnGameLoaded += OnGameLoaded;
+            SetProgress(SaveSystem.Instance.GetLullabySongProgress(), true);
+        }
+        else
+        {
+            SetProgress(0, true);
+        }
+
+        if (playOnStart)
+            Play();
+    }
+
+    void OnDestroy()
+    {
+        if (SaveSystem.Instance != null)
+        {
+            SaveSystem.Instance.OnLullabyProgressChanged -= SetProgress;
+            SaveSystem.Instance.OnGameLoaded -= OnGameLoaded;
+        }
+    }
+
+    void OnGameLoaded(GameSaveData data)
+    {
+        SetProgress(data.lullabySongProgress, true);
+    }
+
+    public void Play()
+    {
+        if (isPlaying || sources.Length == 0) return;
+
+        // One shared DSP start time keeps every stem sample-aligned
+        StartDspTime = AudioSettings.dspTime + scheduleLead;
+        foreach (AudioSource source in sources)
+        {
+            if (source.clip != null)
+                source.PlayScheduled(StartDspTime);
+        }
+
+        isPlaying = true;
+    }
+
+    public void Stop()
+    {
+        foreach (AudioSource source in sources)
+            source.Stop();
+
+        isPlaying = false;
+    }
+
+    public void SetProgress(int fragments)
+    {
+        SetProgress(fragments, false);
+    }
+
+    // Layers fade in the frame the fragment is collected; a load snaps straight there
+    public void SetProgress(int fragments, bool immediate)
+    {
+        audibleLayers = Mathf.Clamp(fragments + (baseLayerAlwaysOn ? 1 : 0), 0, sources.Length);
+
+        if (!immediate) return;
+
+        float output = OutputVolume;
+        for (int i = 0; i < sources.Length; i++)
+        {
+            layerVolumes[i] = i < audibleLayers ? 1f : 0f;
+            sources[i].volume = layerVolumes[i] * output;
+        }
+    }
+
+    // Follows the music slider when there's no mixer to do it
+    float OutputVolume => volume * AudioVoiceManager.CategoryVolume(AudioCategory.Music);
+
+    void Update()
+    {
+        float step = layerFadeTime > 0f ? Time.unscaledDeltaTime / layerFadeTime : 1f;
+        float output = OutputVolume;
+
+        for (int i = 0; i < sources.Length; i++)
+        {
+            float target = i < audibleLayers ? 1f : 0f;
+            if (layerVolumes[i] == target && sources[i].volume == target * output) continue;
+
+            // Volume only - the stem keeps playing, silent or not
+            layerVolumes[i] = Mathf.MoveTowards(layerVolumes[i], target, step);
+            sources[i].volume = layerVolumes[i] * output;
+        }
+    }
+
+    [ContextMenu("Add Layer")]
+    void AddLayer()
+    {
+        audibleLayers = Mathf.Min(audibleLayers + 1, sources.Length);
+    }
+
+    [ContextMenu("Remove Layer")]
+    void RemoveLayer()
+    {
+        audibleLayers = Mathf.Max(audibleLayers - 1, 0);
+    }
+}
@@ -0,0 +1,36 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+// Every room's audio profile, loaded once from Resources/Config by RoomAudioManager
+[CreateAssetMenu(fileName = "RoomAudioLibrary", menuName = "Game/Room Audio Library")]
+public class RoomAudioLibrary : ScriptableObject
+{
+    public List<RoomAudioProfile> rooms = new List<RoomAudioProfile>();
+
+    private Dictionary<string, RoomAudioProfile> roomLookup;
+
+    void OnEnable()
+    {
+        BuildLookupDictionary();
+    }
+
+    void BuildLookupDictionary()
+    {
+        roomLookup = new Dictionary<string, RoomAudioProfile>();
+        foreach (RoomAudioProfile room in rooms)
+        {
+            if (room != null && !string.IsNullOrEmpty(room.roomName))
+            {
+                roomLookup[room.roomName] = room;
+            }
+        }
+    }
+
+    public RoomAudioProfile GetRoom(string roomName)
+    {
+        if (roomLookup == null)
+            BuildLookupDictionary();
+
+        return roomName != null && roomLookup.TryGetValue(roomName, out RoomAudioProfile room) ? room : null;
+    }
+}
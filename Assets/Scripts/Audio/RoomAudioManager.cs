@@ -0,0 +1,315 @@
+using UnityEngine;
+using UnityEngine.Audio;
+using UnityEngine.Profiling;
+using System.Collections.Generic;
+
+// Decides which room audio is resident. Music and ambience stream from disk and
+// crossfade on room change (with a MainAudioMixer snapshot transition); SFX banks
+// for the current room and its neighbours are loaded ahead of time and banks for
+// every other room are unloaded.
+public class RoomAudioManager : PersistentSingleton<RoomAudioManager>
+{
+    [Header("Library")]
+    public string libraryPath = "Config/RoomAudioLibrary"; // Under Resources
+
+    [Header("Transitions")]
+    public float crossfadeTime = 2f;
+
+    [Header("Debug")]
+    public bool logMemory = true;
+
+    // Two sources per layer so the outgoing room's loop can fade under the incoming one
+    class StreamedLoop
+    {
+        public AudioCategory category;
+        public AudioSource incoming;
+        public AudioSource outgoing;
+        public float targetVolume; // Profile volume, before the category volume
+        private float incomingStartVolume;
+        private float outgoingStartVolume;
+
+        float Gain => AudioVoiceManager.CategoryVolume(category);
+
+        public void Switch(AudioClip clip, float volume)
+        {
+            targetVolume = volume;
+            incomingStartVolume = incoming.volume;
+            outgoingStartVolume = 0f;
+
+            // Same loop in the next room: keep playing, no re-seek
+            if (clip != null && incoming.clip == clip) return;
+
+            AudioSource previous = outgoing;
+            outgoing = incoming;
+            incoming = previous;
+            incomingStartVolume = 0f;
+            outgoingStartVolume = outgoing.volume;
+
+            incoming.Stop();
+            incoming.clip = clip;
+            incoming.volume = 0f;
+            if (clip != null)
+                incoming.Play();
+        }
+
+        public void Fade(float t)
+        {
+            if (incoming.clip != null)
+                incoming.volume = Mathf.Lerp(incomingStartVolume, targetVolume * Gain, t);
+            outgoing.volume = outgoingStartVolume * (1f - t);
+        }
+
+        // Frees the outgoing stream once it's silent
+        public void FinishFade()
+        {
+            ApplyVolume();
+
+            AudioClip previousClip = outgoing.clip;
+            outgoing.Stop();
+            outgoing.clip = null;
+
+            if (previousClip != null && previousClip != incoming.clip)
+                previousClip.UnloadAudioData();
+        }
+
+        public void ApplyVolume()
+        {
+            if (incoming.clip != null)
+                incoming.volume = targetVolume * Gain;
+        }
+    }
+
+    private RoomAudioLibrary library;
+    private RoomAudioProfile currentRoom;
+    private StreamedLoop music;
+    private StreamedLoop ambience;
+    private float fadeElapsed = -1f; // < 0 when no crossfade is running
+
+    private readonly HashSet<AudioClip> residentClips = new HashSet<AudioClip>();
+    private readonly HashSet<AudioClip> desiredClips = new HashSet<AudioClip>();
+    private readonly List<AudioClip> evictScratch = new List<AudioClip>();
+
+    public RoomAudioProfile CurrentRoom => currentRoom;
+
+    protected override void OnSingletonAwake()
+    {
+        library = Resources.Load<RoomAudioLibrary>(libraryPath);
+        if (library == null)
+            Debug.LogWarning($"[RoomAudioManager] No RoomAudioLibrary at Resources/{libraryPath} - room audio disabled");
+
+        music = new StreamedLoop { category = AudioCategory.Music, incoming = CreateLoopSource("Music A"), outgoing = CreateLoopSource("Music B") };
+        ambience = new StreamedLoop { category = AudioCategory.Ambient, incoming = CreateLoopSource("Ambience A"), outgoing = CreateLoopSource("Ambience B") };
+
+        AudioVoiceManager.OnCategoryVolumeChanged += OnCategoryVolumeChanged;
+    }
+
+    protected override void OnSingletonDestroy()
+    {
+        AudioVoiceManager.OnCategoryVolumeChanged -= OnCategoryVolumeChanged;
+    }
+
+    // Settings sliders without a mixer; a running crossfade picks the new volume up as it goes
+    void OnCategoryVolumeChanged(AudioCategory category, float volume)
+    {
+        if (fadeElapsed >= 0f) return;
+
+        if (category == music.category)
+            music.ApplyVolume();
+        if (category == ambience.category)
+            ambience.ApplyVolume();
+    }
+
+    AudioSource CreateLoopSource(string sourceName)
+    {
+        GameObject sourceObj = new GameObject(sourceName);
+        sourceObj.transform.SetParent(transform, false);
+
+        AudioSource source = sourceObj.AddComponent<AudioSource>();
+        source.playOnAwake = false;
+        source.loop = true;
+        source.priority = 0; // Never culled for one-shots
+        source.spatialBlend = 0f;
+        return source;
+    }
+
+    void Update()
+    {
+        if (fadeElapsed < 0f) return;
+
+        // Unscaled so the pause menu doesn't freeze a transition halfway
+        fadeElapsed += Time.unscaledDeltaTime;
+        float t = crossfadeTime > 0f ? Mathf.Clamp01(fadeElapsed / crossfadeTime) : 1f;
+
+        music.Fade(t);
+        ambience.Fade(t);
+
+        if (t >= 1f)
+        {
+            music.FinishFade();
+            ambience.FinishFade();
+            fadeElapsed = -1f;
+        }
+    }
+
+    // Called by RoomContext when a room becomes the current one
+    public void EnterRoom(string roomName)
+    {
+        if (library == null) return;
+
+        RoomAudioProfile room = library.GetRoom(roomName);
+        if (room == null)
+        {
+            Debug.LogWarning($"[RoomAudioManager] No audio profile for {roomName}");
+            return;
+        }
+
+        if (room == currentRoom) return;
+        currentRoom = room;
+
+        RouteSources();
+
+        // A transition interrupted midway finishes now so its outgoing stream is released
+        if (fadeElapsed >= 0f)
+        {
+            music.FinishFade();
+            ambience.FinishFade();
+        }
+
+        music.Switch(room.music, room.musicVolume);
+        ambience.Switch(room.ambience, room.ambienceVolume);
+        fadeElapsed = 0f;
+
+        TransitionSnapshot(room.snapshotName);
+        UpdateBanks(room);
+
+        if (logMemory)
+            LogResidentMemory();
+    }
+
+    void RouteSources()
+    {
+        AudioVoiceManager voiceManager = AudioVoiceManager.Instance;
+        if (voiceManager == null) return;
+
+        AudioMixerGroup musicGroup = voiceManager.GetMixerGroup(AudioCategory.Music);
+        AudioMixerGroup ambientGroup = voiceManager.GetMixerGroup(AudioCategory.Ambient);
+
+        music.incoming.outputAudioMixerGroup = musicGroup;
+        music.outgoing.outputAudioMixerGroup = musicGroup;
+        ambience.incoming.outputAudioMixerGroup = ambientGroup;
+        ambience.outgoing.outputAudioMixerGroup = ambientGroup;
+    }
+
+    void TransitionSnapshot(string snapshotName)
+    {
+        AudioMixer mixer = AudioVoiceManager.HasInstance ? AudioVoiceManager.Instance.mixer : null;
+        if (mixer == null || string.IsNullOrEmpty(snapshotName)) return;
+
+        AudioMixerSnapshot snapshot = mixer.FindSnapshot(snapshotName);
+        if (snapshot != null)
+            snapshot.TransitionTo(crossfadeTime);
+        else
+            Debug.LogWarning($"[RoomAudioManager] MainAudioMixer has no snapshot named {snapshotName}");
+    }
+
+    // Current room and neighbours stay resident, everything else is evicted
+    void UpdateBanks(RoomAudioProfile room)
+    {
+        desiredClips.Clear();
+        AddBank(room);
+        foreach (string adjacent in room.adjacentRooms)
+        {
+            AddBank(library.GetRoom(adjacent));
+        }
+
+        foreach (AudioClip clip in desiredClips)
+        {
+            // Loads on a background thread when the clip has Load In Background set
+            if (clip.loadState == AudioDataLoadState.Unloaded)
+                clip.LoadAudioData();
+            residentClips.Add(clip);
+        }
+
+        evictScratch.Clear();
+        foreach (AudioClip clip in residentClips)
+        {
+            if (!desiredClips.Contains(clip))
+                evictScratch.Add(clip);
+        }
+
+        foreach (AudioClip clip in evictScratch)
+        {
+            clip.UnloadAudioData();
+            residentClips.Remove(clip);
+        }
+    }
+
+    void AddBank(RoomAudioProfile room)
+    {
+        if (room == null) return;
+
+        foreach (AudioClip clip in room.sfxBank)
+        {
+            if (clip != null)
+                desiredClips.Add(clip);
+        }
+    }
+
+    public bool IsResident(AudioClip clip)
+    {
+        return clip != null && clip.loadState == AudioDataLoadState.Loaded;
+    }
+
+    // Runtime memory sizes are only reported in development builds and the editor
+    static long GetClipBytes(AudioClip clip)
+    {
+        return clip != null && clip.loadState == AudioDataLoadState.Loaded ? Profiler.GetRuntimeMemorySizeLong(clip) : 0;
+    }
+
+    public long GetResidentBytes(RoomAudioProfile room)
+    {
+        if (room == null) return 0;
+
+        long bytes = 0;
+        foreach (AudioClip clip in room.sfxBank)
+        {
+            bytes += GetClipBytes(clip);
+        }
+
+        // Streamed loops only hold their decode buffers
+        if (room == currentRoom)
+        {
+            bytes += GetClipBytes(room.music);
+            bytes += GetClipBytes(room.ambience);
+        }
+
+        return bytes;
+    }
+
+    [ContextMenu("Log Resident Memory")]
+    public void LogResidentMemory()
+    {
+        if (library == null || currentRoom == null) return;
+
+        System.Text.StringBuilder report = new System.Text.StringBuilder();
+        long total = 0;
+
+        foreach (RoomAudioProfile room in library.rooms)
+        {
+            long bytes = GetResidentBytes(room);
+            if (bytes == 0 && room != currentRoom) continue;
+
+            int loaded = 0;
+            foreach (AudioClip clip in room.sfxBank)
+            {
+                if (IsResident(clip))
+                    loaded++;
+            }
+
+            total += bytes;
+            report.Append($"\n  {room.roomName}{(room == currentRoom ? " (current)" : "")}: {bytes / 1024f:F0} KB, {loaded}/{room.sfxBank.Length} bank clips");
+        }
+
+        Debug.Log($"[RoomAudioManager] {currentRoom.roomName}: {total / (1024f * 1024f):F2} MB resident audio, {residentClips.Count} bank clips{report}");
+    }
+}
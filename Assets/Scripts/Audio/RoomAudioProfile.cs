@@ -0,0 +1,25 @@
+using UnityEngine;
+
+// One room's soundscape. Music and ambience should be imported as Streaming; bank
+// clips as Compressed In Memory with Preload Audio Data off, so RoomAudioManager
+// decides when they're resident (see AudioImportRules).
+[CreateAssetMenu(fileName = "RoomAudioProfile", menuName = "Game/Room Audio Profile")]
+public class RoomAudioProfile : ScriptableObject
+{
+    public string roomName; // Scene name
+
+    [Header("Streamed Loops")]
+    public AudioClip music;
+    public AudioClip ambience;
+    [Range(0f, 1f)] public float musicVolume = 1f;
+    [Range(0f, 1f)] public float ambienceVolume = 1f;
+
+    [Header("Mix")]
+    public string snapshotName = "Snapshot"; // MainAudioMixer snapshot to transition to
+
+    [Header("SFX Bank")]
+    public AudioClip[] sfxBank = new AudioClip[0];
+
+    [Header("Neighbours")]
+    public string[] adjacentRooms = new string[0]; // Banks kept resident while in this room
+}
@@ -0,0 +1,101 @@
+using UnityEngine;
+using System.Collections;
+
+// Before/after harness shared by the bake profilers: switches every active TBaked root
+// to the originals, samples, switches to the baked version, samples again and logs
+// both. Subclasses only say how to sample and what to report.
+public abstract class BakeComparison<TBaked, TStats> : MonoBehaviour where TBaked : BakedToggle<TBaked>
+{
+    [Header("Sampling")]
+    public int warmupSamples = 10;
+    public int sampleCount = 120; // Frames, or fixed steps for physics
+    public bool runOnStart = false;
+
+    public TStats Before { get; private set; }
+    public TStats After { get; private set; }
+    public bool IsRunning { get; private set; }
+
+    // Menu item that produces the baked roots, for the warning when there are none
+    protected abstract string BakeMenu { get; }
+
+    void Start()
+    {
+        if (runOnStart)
+            RunComparison();
+    }
+
+    [ContextMenu("Run Before/After Comparison")]
+    public void RunComparison()
+    {
+        if (IsRunning) return;
+
+        if (BakedToggle<TBaked>.Active.Count == 0)
+        {
+            Debug.LogWarning($"[{GetType().Name}] No {typeof(TBaked).Name} in the loaded scenes - run {BakeMenu} first");
+            return;
+        }
+
+        StartCoroutine(ComparisonRoutine());
+    }
+
+    IEnumerator ComparisonRoutine()
+    {
+        IsRunning = true;
+        BeginComparison();
+
+        SetBaked(false);
+        yield return Sample(false, result => Before = result);
+
+        SetBaked(true);
+        yield return Sample(true, result => After = result);
+
+        EndComparison();
+        IsRunning = false;
+        LogReport();
+    }
+
+    static void SetBaked(bool enabled)
+    {
+        foreach (TBaked baked in BakedToggle<TBaked>.Active)
+        {
+            baked.SetBakedEnabled(enabled);
+        }
+    }
+
+    protected virtual void BeginComparison() { }
+    protected virtual void EndComparison() { }
+
+    // Samples the current configuration; every root has already been switched
+    protected abstract IEnumerator Sample(bool baked, System.Action<TStats> onDone);
+
+    protected abstract string BuildReport();
+
+    [ContextMenu("Log Report")]
+    public void LogReport()
+    {
+        Debug.Log(BuildReport());
+    }
+
+    // Warmup frames, then the render counters averaged over sampleCount frames.
+    // onFrame runs after each sampled frame, for extra per-frame stats.
+    protected IEnumerator SampleRenderStats(string markerName, System.Action onFrame, System.Action<RenderStatsRecorder.Result> onDone)
+    {
+        for (int i = 0; i < warmupSamples; i++)
+            yield return null;
+
+        WaitForEndOfFrame endOfFrame = new WaitForEndOfFrame();
+
+        using (RenderStatsRecorder recorder = new RenderStatsRecorder(markerName))
+        {
+            for (int i = 0; i < sampleCount; i++)
+            {
+                yield return endOfFrame;
+
+                recorder.SampleFrame();
+                onFrame?.Invoke();
+            }
+
+            onDone(recorder.GetResult());
+        }
+    }
+}
@@ -0,0 +1,50 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+public enum BakedColliderMode
+{
+    Edges,   // Closed edge loops, like CompositeCollider2D outlines
+    Polygons // Solid polygons with holes
+}
+
+// Merged collision outlines baked from one collision tilemap (see CollisionGeometryBaker).
+// The per-tile TilemapCollider2D stays on the tilemap, disabled, for authoring and comparison.
+public class BakedCollisionGeometry : BakedToggle<BakedCollisionGeometry>
+{
+    [Header("Bake Info")]
+    public BakedColliderMode mode = BakedColliderMode.Edges;
+    public int sourceTileCount;
+    public int bakedPathCount;
+    public int bakedVertexCount;
+
+    [Header("Colliders")]
+    public List<Collider2D> sourceColliders = new List<Collider2D>();
+    public List<Collider2D> bakedColliders = new List<Collider2D>();
+
+    // true = merged outlines, false = the original per-tile colliders
+    protected override void ApplyBaked(bool enabled)
+    {
+        foreach (Collider2D collider in bakedColliders)
+        {
+            if (collider != null)
+                collider.enabled = enabled;
+        }
+
+        foreach (Collider2D collider in sourceColliders)
+        {
+            if (collider != null)
+                collider.enabled = !enabled;
+        }
+    }
+
+    public int GetShapeCount(bool baked)
+    {
+        int shapes = 0;
+        foreach (Collider2D collider in baked ? bakedColliders : sourceColliders)
+        {
+            if (collider != null && collider.enabled)
+                shapes += collider.shapeCount;
+        }
+        return shapes;
+    }
+}
@@ -0,0 +1,34 @@
+using UnityEngine;
+using UnityEngine.Rendering.Universal;
+using UnityEngine.Tilemaps;
+using System.Collections.Generic;
+
+// Root of the merged wall casters baked from one collision tilemap (see ShadowCasterBaker).
+// Keeps the casters it replaced so the before/after comparison can swap them back.
+[RequireComponent(typeof(CompositeShadowCaster2D))]
+public class BakedShadowCasters : BakedToggle<BakedShadowCasters>
+{
+    [Header("Bake Info")]
+    public Tilemap sourceTilemap;
+    public int sourceTileCount;
+    public int bakedCasterCount;
+    public int bakedVertexCount;
+
+    [Header("Replaced Casters")]
+    public List<ShadowCaster2D> replacedCasters = new List<ShadowCaster2D>();
+
+    // true = merged casters, false = the original per-object casters
+    protected override void ApplyBaked(bool enabled)
+    {
+        foreach (Transform child in transform)
+        {
+            child.gameObject.SetActive(enabled);
+        }
+
+        foreach (ShadowCaster2D caster in replacedCasters)
+        {
+            if (caster != null)
+                caster.enabled = !enabled;
+        }
+    }
+}
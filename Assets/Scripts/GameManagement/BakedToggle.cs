@@ -0,0 +1,32 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+// Base for baked roots that keep the objects they replaced, so BakeComparison can
+// switch a room between the original and the baked version. Enabled roots of each
+// type are listed in Active.
+public abstract class BakedToggle<T> : MonoBehaviour where T : BakedToggle<T>
+{
+    private static readonly List<T> active = new List<T>();
+    public static IReadOnlyList<T> Active => active;
+
+    public bool BakedEnabled { get; private set; } = true;
+
+    protected virtual void OnEnable()
+    {
+        active.Add((T)this);
+    }
+
+    protected virtual void OnDisable()
+    {
+        active.Remove((T)this);
+    }
+
+    // true = baked objects, false = the originals
+    public void SetBakedEnabled(bool enabled)
+    {
+        BakedEnabled = enabled;
+        ApplyBaked(enabled);
+    }
+
+    protected abstract void ApplyBaked(bool enabled);
+}
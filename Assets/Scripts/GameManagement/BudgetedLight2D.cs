@@ -0,0 +1,29 @@
+using UnityEngine;
+using UnityEngine.Rendering.Universal;
+
+// Put on scene Light2Ds (candles, lamps) so LightingOptimizer can budget them
+[RequireComponent(typeof(Light2D))]
+public class BudgetedLight2D : MonoBehaviour
+{
+    [Header("Budget")]
+    public bool alwaysOn = false;
+    public bool externallyDriven = false; // Set when a flicker script owns the intensity
+
+    private Light2D light2D;
+
+    void Awake()
+    {
+        light2D = GetComponent<Light2D>();
+    }
+
+    void OnEnable()
+    {
+        LightingOptimizer.Register(light2D, alwaysOn, externallyDriven);
+    }
+
+    // Inactive lights (sleeping rooms included) give their budget slot back
+    void OnDisable()
+    {
+        LightingOptimizer.Unregister(light2D);
+    }
+}
@@ -24,11 +24,16 @@ public class CameraFollow : MonoBehaviour
     public bool useSmoothing = true;
     public float smoothTime = 0.3f;
 
+    [Header("Pixel Grid")]
+    public bool snapToPixelGrid = true; // Only applies with a PixelPerfectRenderer on this camera
+
     // Internal variables
     private Vector3 velocity = Vector3.zero;
     private float cameraHalfHeight;
     private float cameraHalfWidth;
     private Bounds tilemapBounds;
+    private PixelPerfectRenderer pixelRenderer;
+    private Vector3 followPosition; // Unsnapped, so smoothing keeps sub-pixel progress
 
     // Public boundary properties (for external access)
     public float minX { get; private set; }
@@ -39,13 +44,20 @@ public class CameraFollow : MonoBehaviour
     void Start()
     {
         // Find target if not assigned
+        if (target == null)
+            target = RoomContext.Player;
+
         if (target == null)
         {
+            RoomContext.ReportFallback("Camera target");
             GameObject player = GameObject.FindGameObjectWithTag("Player");
             if (player != null)
                 target = player.transform;
         }
 
+        pixelRenderer = GetComponent<PixelPerfectRenderer>();
+        followPosition = transform.position;
+
         // Calculate camera dimensions
         CalculateCameraSize();
 
@@ -100,7 +112,17 @@ public class CameraFollow : MonoBehaviour
     {
         if (boundaryTilemaps == null || boundaryTilemaps.Length == 0)
         {
+            // Baked rooms already know their combined bounds
+            RoomMetadata metadata = RoomContext.Current != null ? RoomContext.Current.metadata : null;
+            if (metadata != null)
+            {
+                tilemapBounds = metadata.cameraBounds;
+                SetBoundariesFromTilemap();
+                return;
+            }
+
             // Auto-find tilemaps if none assigned
+            RoomContext.ReportFallback("Camera boundary tilemaps");
             AutoFindTilemaps();
         }
 
@@ -209,12 +231,18 @@ public class CameraFollow : MonoBehaviour
         // Move camera
         if (useSmoothing)
         {
-            transform.position = Vector3.SmoothDamp(transform.position, desiredPosition, ref velocity, smoothTime);
+            followPosition = Vector3.SmoothDamp(followPosition, desiredPosition, ref velocity, smoothTime);
         }
         else
         {
-            transform.position = Vector3.Lerp(transform.position, desiredPosition, followSpeed * Time.deltaTime);
+            followPosition = Vector3.Lerp(followPosition, desiredPosition, followSpeed * Time.deltaTime);
         }
+
+        // Whole art pixels only, otherwise the low-res target shimmers as the camera drifts
+        if (snapToPixelGrid && pixelRenderer != null && pixelRenderer.enabled)
+            transform.position = pixelRenderer.SnapToPixel(followPosition);
+        else
+            transform.position = followPosition;
     }
 
     // Public methods for external control
@@ -0,0 +1,45 @@
+using UnityEditor;
+
+// First-import defaults for Assets/Audio so room audio matches what RoomAudioManager
+// expects. Only applied when a clip has no import settings yet; later tweaks stick.
+//   Music/, Ambient/  -> Streaming (only a decode buffer is resident)
+//   SFX/Rooms/        -> Compressed In Memory, loaded per room bank
+//   SFX/ (other)      -> Compressed In Memory, preloaded with the scene
+public class AudioImportRules : AssetPostprocessor
+{
+    const string MusicFolder = "Assets/Audio/Music/";
+    const string AmbientFolder = "Assets/Audio/Ambient/";
+    const string SfxFolder = "Assets/Audio/SFX/";
+    const string RoomBankFolder = "Assets/Audio/SFX/Rooms/";
+
+    void OnPreprocessAudio()
+    {
+        if (!assetImporter.importSettingsMissing) return;
+
+        AudioImporter importer = (AudioImporter)assetImporter;
+        AudioImporterSampleSettings settings = importer.defaultSampleSettings;
+        settings.compressionFormat = AudioCompressionFormat.Vorbis;
+
+        if (assetPath.StartsWith(MusicFolder) || assetPath.StartsWith(AmbientFolder))
+        {
+            settings.loadType = AudioClipLoadType.Streaming;
+            settings.quality = assetPath.StartsWith(MusicFolder) ? 0.7f : 0.5f;
+            importer.loadInBackground = true;
+        }
+        else if (assetPath.StartsWith(SfxFolder))
+        {
+            settings.loadType = AudioClipLoadType.CompressedInMemory;
+            settings.quality = 0.5f;
+
+            bool banked = assetPath.StartsWith(RoomBankFolder);
+            settings.preloadAudioData = !banked;
+            importer.loadInBackground = banked;
+        }
+        else
+        {
+            return;
+        }
+
+        importer.defaultSampleSettings = settings;
+    }
+}
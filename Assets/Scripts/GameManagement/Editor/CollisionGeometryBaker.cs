@@ -0,0 +1,157 @@
+using UnityEngine;
+using UnityEngine.Tilemaps;
+using UnityEditor;
+using UnityEditor.SceneManagement;
+using System.Collections.Generic;
+
+// Replaces per-tile TilemapCollider2D shapes with merged outlines traced from the
+// collision tilemaps. The result is plain Edge/PolygonCollider2D data saved in the scene.
+public static class CollisionGeometryBaker
+{
+    const string RootName = "BakedCollision";
+    const float SimplifyTolerance = 0f; // Grid outlines only lose collinear points
+
+    [MenuItem("Tools/Physics/Bake Collision Geometry (Edges)")]
+    static void BakeEdges()
+    {
+        BakeOpenScenes(BakedColliderMode.Edges);
+    }
+
+    [MenuItem("Tools/Physics/Bake Collision Geometry (Polygons)")]
+    static void BakePolygons()
+    {
+        BakeOpenScenes(BakedColliderMode.Polygons);
+    }
+
+    [MenuItem("Tools/Physics/Clear Baked Collision Geometry")]
+    static void ClearOpenScenes()
+    {
+        foreach (BakedCollisionGeometry geometry in Object.FindObjectsByType<BakedCollisionGeometry>(FindObjectsInactive.Include, FindObjectsSortMode.None))
+        {
+            Clear(geometry);
+        }
+
+        EditorSceneManager.MarkAllScenesDirty();
+    }
+
+    static void BakeOpenScenes(BakedColliderMode mode)
+    {
+        int baked = 0;
+        foreach (TilemapCollider2D tilemapCollider in Object.FindObjectsByType<TilemapCollider2D>(FindObjectsSortMode.None))
+        {
+            Bake(tilemapCollider.GetComponent<Tilemap>(), mode);
+            baked++;
+        }
+
+        if (baked == 0)
+            Debug.LogWarning("[CollisionGeometryBaker] No tilemaps with a TilemapCollider2D in the open scenes");
+
+        EditorSceneManager.MarkAllScenesDirty();
+    }
+
+    public static BakedCollisionGeometry Bake(Tilemap tilemap, BakedColliderMode mode)
+    {
+        tilemap.CompressBounds();
+
+        Transform previous = tilemap.transform.Find(RootName);
+        if (previous != null && previous.TryGetComponent(out BakedCollisionGeometry previousBake))
+            Clear(previousBake);
+
+        TilemapCollider2D tilemapCollider = tilemap.GetComponent<TilemapCollider2D>();
+
+        GameObject root = new GameObject(RootName);
+        Undo.RegisterCreatedObjectUndo(root, "Bake Collision Geometry");
+        root.transform.SetParent(tilemap.transform, false);
+        root.layer = tilemap.gameObject.layer;
+        root.isStatic = true;
+
+        BakedCollisionGeometry geometry = root.AddComponent<BakedCollisionGeometry>();
+        geometry.mode = mode;
+
+        HashSet<Vector2Int> filled = TilemapOutlineTracer.GetFilledCells(tilemap);
+        List<TileRegion> regions = TilemapOutlineTracer.TraceRegions(filled);
+
+        // Outline loops in tilemap local space
+        List<Vector2[]> paths = new List<Vector2[]>();
+        foreach (TileRegion region in regions)
+        {
+            foreach (List<Vector2> loop in region.loops)
+            {
+                List<Vector2> simplified = TilemapOutlineTracer.Simplify(loop, SimplifyTolerance);
+                Vector2[] path = new Vector2[simplified.Count];
+                for (int i = 0; i < simplified.Count; i++)
+                {
+                    path[i] = TilemapOutlineTracer.CellToLocal(tilemap, simplified[i]);
+                }
+                paths.Add(path);
+                geometry.bakedVertexCount += path.Length;
+            }
+        }
+
+        if (mode == BakedColliderMode.Polygons)
+        {
+            // Inner paths become holes
+            PolygonCollider2D polygon = root.AddComponent<PolygonCollider2D>();
+            polygon.pathCount = paths.Count;
+            for (int i = 0; i < paths.Count; i++)
+            {
+                polygon.SetPath(i, paths[i]);
+            }
+            CopySettings(tilemapCollider, polygon);
+            geometry.bakedColliders.Add(polygon);
+        }
+        else
+        {
+            foreach (Vector2[] path in paths)
+            {
+                // Close the loop
+                Vector2[] points = new Vector2[path.Length + 1];
+                path.CopyTo(points, 0);
+                points[path.Length] = path[0];
+
+                EdgeCollider2D edge = root.AddComponent<EdgeCollider2D>();
+                edge.points = points;
+                CopySettings(tilemapCollider, edge);
+                geometry.bakedColliders.Add(edge);
+            }
+        }
+
+        // The tile collider (and a composite on top of it, if any) only stay for authoring
+        foreach (Collider2D source in tilemap.GetComponents<Collider2D>())
+        {
+            Undo.RecordObject(source, "Bake Collision Geometry");
+            source.enabled = false;
+            geometry.sourceColliders.Add(source);
+        }
+
+        geometry.sourceTileCount = filled.Count;
+        geometry.bakedPathCount = paths.Count;
+
+        Debug.Log($"[CollisionGeometryBaker] {tilemap.gameObject.scene.name}/{tilemap.name}: {filled.Count} tiles " +
+                  $"({tilemapCollider.shapeCount} shapes) -> {paths.Count} {mode.ToString().ToLower()} paths, {geometry.bakedVertexCount} verts");
+
+        return geometry;
+    }
+
+    public static void Clear(BakedCollisionGeometry geometry)
+    {
+        foreach (Collider2D source in geometry.sourceColliders)
+        {
+            if (source == null) continue;
+
+            Undo.RecordObject(source, "Clear Baked Collision Geometry");
+            source.enabled = true;
+        }
+
+        Undo.DestroyObjectImmediate(geometry.gameObject);
+    }
+
+    static void CopySettings(Collider2D source, Collider2D target)
+    {
+        if (source == null) return;
+
+        target.sharedMaterial = source.sharedMaterial;
+        target.isTrigger = source.isTrigger;
+        target.offset = source.offset;
+    }
+}
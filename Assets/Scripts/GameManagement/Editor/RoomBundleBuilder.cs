@@ -0,0 +1,314 @@
+using UnityEngine;
+using UnityEditor;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using Debug = UnityEngine.Debug;
+
+[System.Serializable]
+public class RoomBundleEntry
+{
+    public string name;
+    public long sizeBytes;
+    public int assetCount;  // Explicitly assigned; implicit dependencies are in duplicates
+    public double loadMs;   // LoadFromFile plus LoadAllAssets in the editor, one bundle at a time
+}
+
+[System.Serializable]
+public class RoomBundleDuplicate
+{
+    public string assetPath;
+    public string bundles; // Comma separated; "player" when it also ships from Resources
+}
+
+[System.Serializable]
+public class RoomBundleReport
+{
+    public string date;
+    public string target;
+    public long totalBytes;
+    public double buildSeconds;
+    public List<RoomBundleEntry> bundles = new List<RoomBundleEntry>();
+    public List<RoomBundleDuplicate> duplicates = new List<RoomBundleDuplicate>();
+}
+
+// Packs every room in the RoomGraph into LZ4 (chunk compressed) asset bundles that
+// RoomBundleManager loads at runtime: rooms/<room> holds the scene, content/<room>
+// the tiles, sprites, audio, dialogue and prefabs only that room uses, and
+// content/shared whatever two or more rooms use. Writes bundle_report.json with
+// sizes, load times and assets that still end up in more than one bundle.
+//
+// Headless: Unity -batchmode -quit -projectPath <project> -buildTarget Android
+//           -executeMethod RoomBundleBuilder.BuildFromCommandLine
+public static class RoomBundleBuilder
+{
+    const string GraphPath = "Assets/Resources/Config/RoomGraph.asset";
+    const string OutputRoot = "Builds/RoomBundles";
+    const string ReportFileName = "bundle_report.json";
+    const string UseBundlesMenu = "Tools/Rooms/Use Bundles In Play Mode";
+
+    [MenuItem("Tools/Rooms/Build Room Bundles")]
+    static void BuildFromMenu()
+    {
+        Build(EditorUserBuildSettings.activeBuildTarget);
+    }
+
+    // Read when RoomBundleManager wakes, so it takes effect from the next Play
+    [MenuItem(UseBundlesMenu)]
+    static void ToggleUseBundlesInEditor()
+    {
+        bool useBundles = !EditorPrefs.GetBool(RoomBundleManager.UseBundlesInEditorPref, false);
+        EditorPrefs.SetBool(RoomBundleManager.UseBundlesInEditorPref, useBundles);
+        Debug.Log($"[RoomBundleBuilder] Play mode loads rooms from {(useBundles ? "StreamingAssets bundles" : "the project")}");
+    }
+
+    [MenuItem(UseBundlesMenu, true)]
+    static bool ToggleUseBundlesInEditorValidate()
+    {
+        Menu.SetChecked(UseBundlesMenu, EditorPrefs.GetBool(RoomBundleManager.UseBundlesInEditorPref, false));
+        return true;
+    }
+
+    public static void BuildFromCommandLine()
+    {
+        RoomBundleReport report = Build(EditorUserBuildSettings.activeBuildTarget);
+        EditorApplication.Exit(report != null ? 0 : 1);
+    }
+
+    public static RoomBundleReport Build(BuildTarget target)
+    {
+        RoomGraph graph = AssetDatabase.LoadAssetAtPath<RoomGraph>(GraphPath);
+        if (graph == null)
+        {
+            Debug.LogError($"[RoomBundleBuilder] No RoomGraph at {GraphPath}");
+            return null;
+        }
+
+        Stopwatch stopwatch = Stopwatch.StartNew();
+
+        Dictionary<string, string> roomScenes = FindRoomScenes(graph);
+        if (roomScenes.Count == 0)
+        {
+            Debug.LogError("[RoomBundleBuilder] None of the RoomGraph rooms have a scene");
+            return null;
+        }
+
+        // Which rooms use each asset decides the bundle it goes in
+        Dictionary<string, List<string>> usage = new Dictionary<string, List<string>>();
+        foreach (KeyValuePair<string, string> room in roomScenes)
+        {
+            foreach (string dependency in AssetDatabase.GetDependencies(room.Value, true))
+            {
+                if (!IsBundleable(dependency)) continue;
+
+                if (!usage.TryGetValue(dependency, out List<string> users))
+                {
+                    users = new List<string>();
+                    usage.Add(dependency, users);
+                }
+                users.Add(room.Key);
+            }
+        }
+
+        Dictionary<string, List<string>> contents = new Dictionary<string, List<string>>();
+        foreach (KeyValuePair<string, List<string>> entry in usage)
+        {
+            string bundleName = entry.Value.Count > 1
+                ? RoomBundleManager.SharedBundleName
+                : RoomBundleManager.ContentBundlePrefix + entry.Value[0].ToLowerInvariant();
+
+            if (!contents.TryGetValue(bundleName, out List<string> assets))
+            {
+                assets = new List<string>();
+                contents.Add(bundleName, assets);
+            }
+            assets.Add(entry.Key);
+        }
+
+        // Scenes can't share a bundle with other assets
+        List<AssetBundleBuild> builds = new List<AssetBundleBuild>();
+        foreach (KeyValuePair<string, string> room in roomScenes)
+        {
+            builds.Add(new AssetBundleBuild
+            {
+                assetBundleName = RoomBundleManager.GetSceneBundleName(room.Key),
+                assetNames = new[] { room.Value }
+            });
+        }
+        foreach (KeyValuePair<string, List<string>> bundle in contents)
+        {
+            bundle.Value.Sort();
+            builds.Add(new AssetBundleBuild { assetBundleName = bundle.Key, assetNames = bundle.Value.ToArray() });
+        }
+
+        // The manifest bundle is named after its folder, which is what RoomBundleManager opens
+        string outputPath = Path.Combine(OutputRoot, target.ToString(), RoomBundleManager.BundleFolder);
+        Directory.CreateDirectory(outputPath);
+
+        AssetBundleManifest manifest = BuildPipeline.BuildAssetBundles(outputPath, builds.ToArray(),
+            BuildAssetBundleOptions.ChunkBasedCompression | BuildAssetBundleOptions.StrictMode, target);
+        if (manifest == null)
+        {
+            Debug.LogError("[RoomBundleBuilder] Bundle build failed");
+            return null;
+        }
+
+        CopyToStreamingAssets(outputPath);
+        WarnRoomsInBuildSettings(roomScenes);
+
+        RoomBundleReport report = new RoomBundleReport
+        {
+            date = System.DateTime.Now.ToString("yyyy-MM-dd HH:mm:ss"),
+            target = target.ToString(),
+            buildSeconds = stopwatch.Elapsed.TotalSeconds
+        };
+
+        foreach (AssetBundleBuild build in builds)
+            report.bundles.Add(MeasureBundle(outputPath, build));
+        foreach (RoomBundleEntry entry in report.bundles)
+            report.totalBytes += entry.sizeBytes;
+
+        FindDuplicates(builds, report);
+
+        string reportPath = Path.Combine(OutputRoot, target.ToString(), ReportFileName);
+        File.WriteAllText(reportPath, JsonUtility.ToJson(report, true));
+        LogReport(report, reportPath);
+
+        return report;
+    }
+
+    // Graph room name -> scene path
+    static Dictionary<string, string> FindRoomScenes(RoomGraph graph)
+    {
+        Dictionary<string, string> roomScenes = new Dictionary<string, string>();
+        foreach (string guid in AssetDatabase.FindAssets("t:Scene", new[] { "Assets" }))
+        {
+            string scenePath = AssetDatabase.GUIDToAssetPath(guid);
+            string sceneName = Path.GetFileNameWithoutExtension(scenePath);
+            if (graph.Contains(sceneName) && !roomScenes.ContainsKey(sceneName))
+                roomScenes.Add(sceneName, scenePath);
+        }
+
+        foreach (RoomLink room in graph.rooms)
+        {
+            if (room != null && !string.IsNullOrEmpty(room.roomName) && !roomScenes.ContainsKey(room.roomName))
+                Debug.Log($"[RoomBundleBuilder] {room.roomName} has no scene yet, skipped");
+        }
+
+        return roomScenes;
+    }
+
+    // Scripts are compiled into the player, and Resources content ships with it anyway
+    static bool IsBundleable(string assetPath)
+    {
+        if (!assetPath.StartsWith("Assets/")) return false;
+        if (assetPath.Contains("/Resources/") || assetPath.Contains("/Editor/")) return false;
+
+        string extension = Path.GetExtension(assetPath).ToLowerInvariant();
+        return extension != ".cs" && extension != ".dll" && extension != ".asmdef" && extension != ".unity";
+    }
+
+    static void CopyToStreamingAssets(string outputPath)
+    {
+        string destination = Path.Combine(Application.streamingAssetsPath, RoomBundleManager.BundleFolder);
+        FileUtil.DeleteFileOrDirectory(destination);
+        FileUtil.DeleteFileOrDirectory(destination + ".meta");
+
+        foreach (string file in Directory.GetFiles(outputPath, "*", SearchOption.AllDirectories))
+        {
+            // The .manifest text files are only needed for incremental builds
+            if (file.EndsWith(".manifest")) continue;
+
+            string target = Path.Combine(destination, file.Substring(outputPath.Length + 1));
+            Directory.CreateDirectory(Path.GetDirectoryName(target));
+            File.Copy(file, target, true);
+        }
+
+        AssetDatabase.Refresh();
+    }
+
+    // A room left enabled in the build settings ships in the player data as well as its bundle
+    static void WarnRoomsInBuildSettings(Dictionary<string, string> roomScenes)
+    {
+        foreach (EditorBuildSettingsScene scene in EditorBuildSettings.scenes)
+        {
+            if (scene.enabled && roomScenes.ContainsValue(scene.path))
+                Debug.LogWarning($"[RoomBundleBuilder] {scene.path} is still enabled in Build Settings and ships twice");
+        }
+    }
+
+    static RoomBundleEntry MeasureBundle(string outputPath, AssetBundleBuild build)
+    {
+        string bundlePath = Path.Combine(outputPath, build.assetBundleName);
+        RoomBundleEntry entry = new RoomBundleEntry
+        {
+            name = build.assetBundleName,
+            sizeBytes = File.Exists(bundlePath) ? new FileInfo(bundlePath).Length : 0,
+            assetCount = build.assetNames.Length,
+            loadMs = -1
+        };
+
+        Stopwatch stopwatch = Stopwatch.StartNew();
+        AssetBundle bundle = AssetBundle.LoadFromFile(bundlePath);
+        if (bundle == null) return entry;
+
+        // Scene bundles only open; their contents load with the scene
+        if (!bundle.isStreamedSceneAssetBundle)
+            bundle.LoadAllAssets();
+
+        entry.loadMs = stopwatch.Elapsed.TotalMilliseconds;
+        bundle.Unload(true);
+        return entry;
+    }
+
+    // Dependencies not assigned to any bundle get copied into every bundle that uses them
+    static void FindDuplicates(List<AssetBundleBuild> builds, RoomBundleReport report)
+    {
+        HashSet<string> assigned = new HashSet<string>();
+        foreach (AssetBundleBuild build in builds)
+            assigned.UnionWith(build.assetNames);
+
+        Dictionary<string, List<string>> implicitUsers = new Dictionary<string, List<string>>();
+        foreach (AssetBundleBuild build in builds)
+        {
+            foreach (string dependency in AssetDatabase.GetDependencies(build.assetNames, true))
+            {
+                if (assigned.Contains(dependency)) continue;
+
+                string extension = Path.GetExtension(dependency).ToLowerInvariant();
+                if (extension == ".cs" || extension == ".dll") continue;
+
+                if (!implicitUsers.TryGetValue(dependency, out List<string> users))
+                {
+                    users = new List<string>();
+                    if (dependency.Contains("/Resources/"))
+                        users.Add("player");
+                    implicitUsers.Add(dependency, users);
+                }
+                users.Add(build.assetBundleName);
+            }
+        }
+
+        foreach (KeyValuePair<string, List<string>> entry in implicitUsers)
+        {
+            if (entry.Value.Count > 1)
+                report.duplicates.Add(new RoomBundleDuplicate { assetPath = entry.Key, bundles = string.Join(",", entry.Value) });
+        }
+        report.duplicates.Sort((a, b) => string.CompareOrdinal(a.assetPath, b.assetPath));
+    }
+
+    static void LogReport(RoomBundleReport report, string reportPath)
+    {
+        System.Text.StringBuilder log = new System.Text.StringBuilder();
+        log.Append($"[RoomBundleBuilder] {report.bundles.Count} bundles, {report.totalBytes / 1024f / 1024f:F2} MB for {report.target} " +
+                   $"in {report.buildSeconds:F1} s, {report.duplicates.Count} duplicated assets -> {reportPath}");
+
+        foreach (RoomBundleEntry entry in report.bundles)
+            log.Append($"\n  {entry.name,-32} {entry.sizeBytes / 1024f,10:F1} KB {entry.assetCount,5} assets {entry.loadMs,8:F1} ms");
+
+        foreach (RoomBundleDuplicate duplicate in report.duplicates)
+            log.Append($"\n  duplicate {duplicate.assetPath} in {duplicate.bundles}");
+
+        Debug.Log(log.ToString());
+    }
+}
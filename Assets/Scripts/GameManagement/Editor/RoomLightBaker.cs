@@ -0,0 +1,64 @@
+using UnityEngine;
+using UnityEditor;
+using UnityEditor.SceneManagement;
+using System.IO;
+
+// Build-time side of RoomLightBake: captures each room's static lights and saves the
+// light texture as a sprite asset so nothing has to be rendered on room load
+public static class RoomLightBaker
+{
+    const string OutputFolder = "Assets/Art/Textures/BakedLighting";
+
+    [MenuItem("Tools/Lighting/Bake Room Light Textures")]
+    static void BakeOpenScenes()
+    {
+        RoomLightBake[] rooms = Object.FindObjectsByType<RoomLightBake>(FindObjectsSortMode.None);
+        if (rooms.Length == 0)
+        {
+            Debug.LogWarning("[RoomLightBaker] No RoomLightBake components in the open scenes");
+            return;
+        }
+
+        foreach (RoomLightBake room in rooms)
+        {
+            Bake(room);
+        }
+
+        EditorSceneManager.MarkAllScenesDirty();
+        AssetDatabase.SaveAssets();
+    }
+
+    public static void Bake(RoomLightBake room)
+    {
+        if (room.staticLights.Count == 0)
+            room.CollectStaticLights();
+
+        Texture2D texture = room.CaptureLightTexture(out float peak);
+        string assetPath = $"{OutputFolder}/{room.gameObject.scene.name}_{room.name}_BakedLight.png";
+
+        Directory.CreateDirectory(OutputFolder);
+        File.WriteAllBytes(assetPath, texture.EncodeToPNG());
+        Object.DestroyImmediate(texture);
+
+        AssetDatabase.ImportAsset(assetPath, ImportAssetOptions.ForceSynchronousImport);
+
+        TextureImporter importer = (TextureImporter)AssetImporter.GetAtPath(assetPath);
+        importer.textureType = TextureImporterType.Sprite;
+        importer.spriteImportMode = SpriteImportMode.Single;
+        importer.spritePixelsPerUnit = room.pixelsPerUnit;
+        importer.spritePivot = new Vector2(0.5f, 0.5f);
+        importer.sRGBTexture = false; // Values are linear light
+        importer.mipmapEnabled = false;
+        importer.wrapMode = TextureWrapMode.Clamp;
+        importer.filterMode = FilterMode.Bilinear;
+        importer.SaveAndReimport();
+
+        Undo.RecordObject(room, "Bake Room Light Texture");
+        room.bakedLightSprite = AssetDatabase.LoadAssetAtPath<Sprite>(assetPath);
+        room.bakedIntensity = peak;
+        EditorUtility.SetDirty(room);
+
+        Debug.Log($"[RoomLightBaker] {room.gameObject.scene.name}: {room.staticLights.Count} static lights -> {assetPath} " +
+                  $"({importer.spritePixelsPerUnit} ppu, peak intensity {peak:F2})");
+    }
+}
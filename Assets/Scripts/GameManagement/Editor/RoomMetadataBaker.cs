@@ -0,0 +1,249 @@
+using UnityEngine;
+using UnityEngine.Rendering.Universal;
+using UnityEngine.SceneManagement;
+using UnityEngine.Tilemaps;
+using UnityEditor;
+using UnityEditor.SceneManagement;
+using System.Collections.Generic;
+using System.IO;
+
+// Does the scene searches once in the editor and stores the results on a RoomContext
+// (scene references) plus a RoomMetadata asset next to the scene (plain data)
+public static class RoomMetadataBaker
+{
+    [MenuItem("Tools/Rooms/Bake Room Metadata")]
+    static void BakeActiveScene()
+    {
+        Scene scene = SceneManager.GetActiveScene();
+        if (string.IsNullOrEmpty(scene.path))
+        {
+            Debug.LogWarning("[RoomMetadataBaker] Save the scene before baking");
+            return;
+        }
+
+        Bake(scene);
+        EditorSceneManager.MarkSceneDirty(scene);
+        AssetDatabase.SaveAssets();
+    }
+
+    public static RoomMetadata Bake(Scene scene)
+    {
+        RoomContext context = FindInScene<RoomContext>(scene);
+        if (context == null)
+        {
+            GameObject contextObj = new GameObject("RoomContext");
+            Undo.RegisterCreatedObjectUndo(contextObj, "Bake Room Metadata");
+            SceneManager.MoveGameObjectToScene(contextObj, scene);
+            context = contextObj.AddComponent<RoomContext>();
+        }
+
+        RoomMetadata metadata = context.metadata;
+        if (metadata == null)
+        {
+            string assetPath = Path.Combine(Path.GetDirectoryName(scene.path), $"{scene.name}_Metadata.asset").Replace('\\', '/');
+            metadata = AssetDatabase.LoadAssetAtPath<RoomMetadata>(assetPath);
+            if (metadata == null)
+            {
+                metadata = ScriptableObject.CreateInstance<RoomMetadata>();
+                AssetDatabase.CreateAsset(metadata, assetPath);
+            }
+        }
+
+        Undo.RecordObject(context, "Bake Room Metadata");
+        Undo.RecordObject(metadata, "Bake Room Metadata");
+
+        metadata.sceneName = scene.name;
+        context.metadata = metadata;
+
+        BakePlayer(scene, context);
+        BakeRoomCanvases(scene, context);
+        BakeTilemaps(scene, context, metadata);
+        BakeInteractables(scene, context, metadata);
+        BakeLights(scene, context, metadata);
+        BakeSpawnPoints(scene, context, metadata);
+        BakeUIAnchors(scene, context, metadata);
+
+        EditorUtility.SetDirty(context);
+        EditorUtility.SetDirty(metadata);
+
+        Debug.Log($"[RoomMetadataBaker] {scene.name}: {metadata.tilemaps.Count} tilemaps, {metadata.interactables.Count} interactables, " +
+                  $"{metadata.lights.Count} lights, {metadata.spawnPoints.Count} spawn points, {metadata.uiAnchors.Count} UI anchors");
+
+        return metadata;
+    }
+
+    static void BakePlayer(Scene scene, RoomContext context)
+    {
+        context.playerController = FindInScene<JoystickPlayerController>(scene);
+        context.player = context.playerController != null ? context.playerController.transform : null;
+
+        if (context.player == null)
+        {
+            foreach (GameObject root in scene.GetRootGameObjects())
+            {
+                if (root.CompareTag("Player"))
+                {
+                    context.player = root.transform;
+                    break;
+                }
+            }
+        }
+
+        context.joystick = FindInScene<VirtualJoystick>(scene);
+        context.joystickUI = context.joystick != null ? context.joystick.gameObject : null;
+    }
+
+    // The room's own copies; its DialogueSystemV2 is destroyed as a duplicate at runtime
+    static void BakeRoomCanvases(Scene scene, RoomContext context)
+    {
+        context.inventoryUI = FindInScene<InventoryUI>(scene);
+
+        DialogueSystemV2 dialogue = FindInScene<DialogueSystemV2>(scene);
+        context.dialoguePanel = dialogue != null ? dialogue.dialoguePanel : null;
+        context.dialogueBoxImage = dialogue != null ? dialogue.dialogueBoxImage : null;
+        context.dialogueText = dialogue != null ? dialogue.dialogueText : null;
+        context.speakerNameText = dialogue != null ? dialogue.speakerNameText : null;
+    }
+
+    // Same filtering CameraFollow.AutoFindTilemaps does at runtime
+    static void BakeTilemaps(Scene scene, RoomContext context, RoomMetadata metadata)
+    {
+        metadata.tilemaps.Clear();
+        List<Tilemap> boundary = new List<Tilemap>();
+        bool hasBounds = false;
+        Bounds combined = new Bounds();
+
+        foreach (Tilemap tilemap in FindAllInScene<Tilemap>(scene))
+        {
+            tilemap.CompressBounds();
+            BoundsInt cellBounds = tilemap.cellBounds;
+
+            Vector3 min = tilemap.CellToWorld(new Vector3Int(cellBounds.xMin, cellBounds.yMin, 0));
+            Vector3 max = tilemap.CellToWorld(new Vector3Int(cellBounds.xMax, cellBounds.yMax, 0));
+            Bounds worldBounds = new Bounds((min + max) * 0.5f, max - min);
+
+            metadata.tilemaps.Add(new TilemapBoundsEntry
+            {
+                tilemapName = tilemap.name,
+                cellBounds = cellBounds,
+                worldBounds = worldBounds,
+                hasCollider = tilemap.GetComponent<TilemapCollider2D>() != null
+            });
+
+            string lowerName = tilemap.name.ToLower();
+            if (cellBounds.size.x <= 0 || cellBounds.size.y <= 0) continue;
+            if (lowerName.Contains("ui") || lowerName.Contains("overlay")) continue;
+
+            boundary.Add(tilemap);
+            if (hasBounds)
+            {
+                combined.Encapsulate(worldBounds);
+            }
+            else
+            {
+                combined = worldBounds;
+                hasBounds = true;
+            }
+        }
+
+        context.boundaryTilemaps = boundary.ToArray();
+        metadata.cameraBounds = combined;
+    }
+
+    static void BakeInteractables(Scene scene, RoomContext context, RoomMetadata metadata)
+    {
+        metadata.interactables.Clear();
+
+        List<ItemPickup> pickups = FindAllInScene<ItemPickup>(scene);
+        foreach (ItemPickup pickup in pickups)
+        {
+            metadata.interactables.Add(new InteractableEntry { id = pickup.itemId, kind = InteractableKind.Pickup, position = pickup.transform.position });
+        }
+
+        List<PuzzleInteractable> puzzles = FindAllInScene<PuzzleInteractable>(scene);
+        foreach (PuzzleInteractable puzzle in puzzles)
+        {
+            metadata.interactables.Add(new InteractableEntry { id = puzzle.puzzleId, kind = InteractableKind.Puzzle, position = puzzle.transform.position });
+        }
+
+        context.pickups = pickups.ToArray();
+        context.puzzles = puzzles.ToArray();
+    }
+
+    static void BakeLights(Scene scene, RoomContext context, RoomMetadata metadata)
+    {
+        metadata.lights.Clear();
+
+        List<Light2D> lights = FindAllInScene<Light2D>(scene);
+        foreach (Light2D light in lights)
+        {
+            metadata.lights.Add(new LightEntry
+            {
+                lightName = light.name,
+                position = light.transform.position,
+                outerRadius = light.pointLightOuterRadius,
+                budgeted = light.GetComponent<BudgetedLight2D>() != null
+            });
+        }
+
+        context.lights = lights.ToArray();
+    }
+
+    static void BakeSpawnPoints(Scene scene, RoomContext context, RoomMetadata metadata)
+    {
+        metadata.spawnPoints.Clear();
+
+        foreach (RoomSpawnPoint spawn in FindAllInScene<RoomSpawnPoint>(scene))
+        {
+            metadata.spawnPoints.Add(new SpawnPointEntry { spawnId = spawn.spawnId, position = spawn.transform.position });
+        }
+
+        // Where the player is placed in the scene doubles as the default entry
+        if (context.player != null && !metadata.TryGetSpawnPoint("Default", out _))
+            metadata.spawnPoints.Add(new SpawnPointEntry { spawnId = "Default", position = context.player.position });
+    }
+
+    static void BakeUIAnchors(Scene scene, RoomContext context, RoomMetadata metadata)
+    {
+        metadata.uiAnchors.Clear();
+
+        AddAnchor(metadata, context.joystickUI);
+
+        PauseMenuManager pauseMenu = FindInScene<PauseMenuManager>(scene);
+        if (pauseMenu != null)
+            AddAnchor(metadata, pauseMenu.pauseButtonObject);
+
+        DialogueSystemV2 dialogue = FindInScene<DialogueSystemV2>(scene);
+        if (dialogue != null)
+            AddAnchor(metadata, dialogue.dialoguePanel);
+    }
+
+    static void AddAnchor(RoomMetadata metadata, GameObject uiObject)
+    {
+        if (uiObject == null || !(uiObject.transform is RectTransform rect)) return;
+
+        metadata.uiAnchors.Add(new UIAnchorEntry
+        {
+            anchorName = uiObject.name,
+            anchorMin = rect.anchorMin,
+            anchorMax = rect.anchorMax,
+            anchoredPosition = rect.anchoredPosition
+        });
+    }
+
+    static T FindInScene<T>(Scene scene) where T : Component
+    {
+        List<T> found = FindAllInScene<T>(scene);
+        return found.Count > 0 ? found[0] : null;
+    }
+
+    static List<T> FindAllInScene<T>(Scene scene) where T : Component
+    {
+        List<T> results = new List<T>();
+        foreach (GameObject root in scene.GetRootGameObjects())
+        {
+            results.AddRange(root.GetComponentsInChildren<T>(true));
+        }
+        return results;
+    }
+}
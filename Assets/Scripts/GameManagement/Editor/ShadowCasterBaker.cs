@@ -0,0 +1,192 @@
+using UnityEngine;
+using UnityEngine.Rendering.Universal;
+using UnityEngine.Tilemaps;
+using UnityEditor;
+using UnityEditor.SceneManagement;
+using System.Collections.Generic;
+
+// Replaces per-tile / per-object wall casters with a few merged ShadowCaster2D outlines
+// per collision tilemap. Shape paths are written once here so the caster meshes are
+// generated and serialized in the scene instead of rebuilt at runtime.
+public static class ShadowCasterBaker
+{
+    const string RootName = "BakedShadowCasters";
+    const float SimplifyTolerance = 0f; // Grid outlines only lose collinear points
+
+    [MenuItem("Tools/Lighting/Bake Static Shadow Casters")]
+    static void BakeOpenScenes()
+    {
+        int rooms = 0;
+        foreach (Tilemap tilemap in Object.FindObjectsByType<Tilemap>(FindObjectsSortMode.None))
+        {
+            // Only collision layers are walls; background/extras never cast
+            if (tilemap.GetComponent<TilemapCollider2D>() == null) continue;
+
+            Bake(tilemap);
+            rooms++;
+        }
+
+        if (rooms == 0)
+            Debug.LogWarning("[ShadowCasterBaker] No tilemaps with a TilemapCollider2D in the open scenes");
+
+        EditorSceneManager.MarkAllScenesDirty();
+    }
+
+    [MenuItem("Tools/Lighting/Clear Baked Shadow Casters")]
+    static void ClearOpenScenes()
+    {
+        foreach (BakedShadowCasters baked in Object.FindObjectsByType<BakedShadowCasters>(FindObjectsInactive.Include, FindObjectsSortMode.None))
+        {
+            Clear(baked);
+        }
+
+        EditorSceneManager.MarkAllScenesDirty();
+    }
+
+    public static BakedShadowCasters Bake(Tilemap tilemap)
+    {
+        tilemap.CompressBounds();
+
+        // Re-bake replaces the previous result but keeps the list of originals
+        List<ShadowCaster2D> replaced = new List<ShadowCaster2D>();
+        Transform previous = tilemap.transform.Find(RootName);
+        if (previous != null && previous.TryGetComponent(out BakedShadowCasters previousBake))
+        {
+            replaced.AddRange(previousBake.replacedCasters);
+            Clear(previousBake);
+        }
+
+        // Casters already on the wall layer (whole tilemap or per-object children)
+        foreach (ShadowCaster2D caster in tilemap.GetComponentsInChildren<ShadowCaster2D>(true))
+        {
+            if (!replaced.Contains(caster))
+                replaced.Add(caster);
+        }
+
+        GameObject root = new GameObject(RootName);
+        Undo.RegisterCreatedObjectUndo(root, "Bake Shadow Casters");
+        root.transform.SetParent(tilemap.transform, false);
+        root.AddComponent<CompositeShadowCaster2D>();
+
+        BakedShadowCasters baked = root.AddComponent<BakedShadowCasters>();
+        baked.sourceTilemap = tilemap;
+
+        HashSet<Vector2Int> filled = TilemapOutlineTracer.GetFilledCells(tilemap);
+        List<TileRegion> regions = TilemapOutlineTracer.TraceRegions(filled);
+        int casterIndex = 0;
+
+        foreach (TileRegion region in regions)
+        {
+            if (!region.HasHoles)
+            {
+                List<Vector2> outline = TilemapOutlineTracer.Simplify(region.loops[0], SimplifyTolerance);
+                baked.bakedVertexCount += outline.Count;
+                CreateCaster(root.transform, tilemap, outline, casterIndex++);
+                continue;
+            }
+
+            // A wall ring filled as one polygon would shadow the room inside it,
+            // so regions with holes fall back to merged rectangles
+            foreach (RectInt rect in TilemapOutlineTracer.GreedyRectangles(region.cells))
+            {
+                List<Vector2> outline = new List<Vector2>
+                {
+                    new Vector2(rect.xMin, rect.yMin),
+                    new Vector2(rect.xMax, rect.yMin),
+                    new Vector2(rect.xMax, rect.yMax),
+                    new Vector2(rect.xMin, rect.yMax)
+                };
+                baked.bakedVertexCount += outline.Count;
+                CreateCaster(root.transform, tilemap, outline, casterIndex++);
+            }
+        }
+
+        foreach (ShadowCaster2D caster in replaced)
+        {
+            if (caster == null) continue;
+
+            Undo.RecordObject(caster, "Bake Shadow Casters");
+            caster.enabled = false;
+            baked.replacedCasters.Add(caster);
+        }
+
+        baked.sourceTileCount = filled.Count;
+        baked.bakedCasterCount = casterIndex;
+
+        Debug.Log($"[ShadowCasterBaker] {tilemap.gameObject.scene.name}/{tilemap.name}: {filled.Count} tiles in {regions.Count} regions -> " +
+                  $"{casterIndex} casters, {baked.bakedVertexCount} verts (replaced {baked.replacedCasters.Count} casters)");
+
+        return baked;
+    }
+
+    public static void Clear(BakedShadowCasters baked)
+    {
+        foreach (ShadowCaster2D caster in baked.replacedCasters)
+        {
+            if (caster == null) continue;
+
+            Undo.RecordObject(caster, "Clear Baked Shadow Casters");
+            caster.enabled = true;
+        }
+
+        Undo.DestroyObjectImmediate(baked.gameObject);
+    }
+
+    static void CreateCaster(Transform parent, Tilemap tilemap, List<Vector2> cellOutline, int index)
+    {
+        GameObject casterObj = new GameObject($"WallCaster_{index:00}");
+        casterObj.transform.SetParent(parent, false);
+
+        ShadowCaster2D caster = casterObj.AddComponent<ShadowCaster2D>();
+
+        // Shape path is in the caster's local space, which matches the tilemap's
+        Vector3[] shapePath = new Vector3[cellOutline.Count];
+        for (int i = 0; i < cellOutline.Count; i++)
+        {
+            shapePath[i] = TilemapOutlineTracer.CellToLocal(tilemap, cellOutline[i]);
+        }
+
+        // No public setter for the shape path; write the serialized fields the shape editor uses
+        SerializedObject serialized = new SerializedObject(caster);
+
+        SerializedProperty pathProperty = serialized.FindProperty("m_ShapePath");
+        pathProperty.arraySize = shapePath.Length;
+        for (int i = 0; i < shapePath.Length; i++)
+        {
+            pathProperty.GetArrayElementAtIndex(i).vector3Value = shapePath[i];
+        }
+
+        // A new hash makes the caster regenerate (and serialize) its shadow mesh
+        SerializedProperty hashProperty = serialized.FindProperty("m_ShapePathHash");
+        if (hashProperty != null)
+            hashProperty.intValue = GetPathHash(shapePath);
+
+        // Use the shape path rather than a renderer silhouette or collider provider
+        SerializedProperty sourceProperty = serialized.FindProperty("m_ShadowCastingSource");
+        if (sourceProperty != null)
+            sourceProperty.intValue = 1; // ShadowCastingSources.ShapeEditor
+
+        SerializedProperty selfShadowsProperty = serialized.FindProperty("m_SelfShadows");
+        if (selfShadowsProperty != null)
+            selfShadowsProperty.boolValue = false;
+
+        serialized.ApplyModifiedPropertiesWithoutUndo();
+
+        // Cycle the component so the edit-mode update builds the mesh now
+        caster.enabled = false;
+        caster.enabled = true;
+    }
+
+    static int GetPathHash(Vector3[] path)
+    {
+        unchecked
+        {
+            int hash = 17;
+            foreach (Vector3 point in path)
+            {
+                hash = hash * 31 + point.GetHashCode();
+            }
+            return hash;
+        }
+    }
+}
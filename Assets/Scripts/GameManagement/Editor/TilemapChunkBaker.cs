@@ -0,0 +1,241 @@
+using UnityEngine;
+using UnityEngine.Rendering;
+using UnityEngine.SceneManagement;
+using UnityEngine.Tilemaps;
+using UnityEditor;
+using UnityEditor.SceneManagement;
+using System.Collections.Generic;
+using System.IO;
+
+// Converts static Tilemap layers into fixed-size chunk meshes (one per chunk per
+// texture, so a Tileset.png layer is one mesh per chunk). Meshes and materials are
+// stored in one asset next to the scene; source TilemapRenderers are disabled.
+public static class TilemapChunkBaker
+{
+    const int ChunkSize = 16;
+    const string RootName = "BakedTileChunks";
+
+    [MenuItem("Tools/Rooms/Bake Tilemap Chunks")]
+    static void BakeActiveScene()
+    {
+        Scene scene = SceneManager.GetActiveScene();
+        if (string.IsNullOrEmpty(scene.path))
+        {
+            Debug.LogWarning("[TilemapChunkBaker] Save the scene before baking");
+            return;
+        }
+
+        Bake(scene);
+        EditorSceneManager.MarkSceneDirty(scene);
+        AssetDatabase.SaveAssets();
+    }
+
+    [MenuItem("Tools/Rooms/Clear Tilemap Chunks")]
+    static void ClearActiveScene()
+    {
+        foreach (TilemapChunkRoot root in Object.FindObjectsByType<TilemapChunkRoot>(FindObjectsInactive.Include, FindObjectsSortMode.None))
+        {
+            Clear(root);
+        }
+
+        EditorSceneManager.MarkSceneDirty(SceneManager.GetActiveScene());
+    }
+
+    public static void Bake(Scene scene)
+    {
+        string assetPath = Path.Combine(Path.GetDirectoryName(scene.path), $"{scene.name}_TileChunks.asset").Replace('\\', '/');
+        AssetDatabase.DeleteAsset(assetPath);
+
+        TileChunkAsset container = ScriptableObject.CreateInstance<TileChunkAsset>();
+        AssetDatabase.CreateAsset(container, assetPath);
+
+        int layers = 0;
+        int chunkCount = 0;
+        int tileCount = 0;
+
+        foreach (GameObject sceneRoot in scene.GetRootGameObjects())
+        {
+            foreach (TilemapRenderer tilemapRenderer in sceneRoot.GetComponentsInChildren<TilemapRenderer>(true))
+            {
+                Tilemap tilemap = tilemapRenderer.GetComponent<Tilemap>();
+                if (tilemap == null) continue;
+
+                Transform previous = tilemap.transform.Find(RootName);
+                if (previous != null && previous.TryGetComponent(out TilemapChunkRoot previousRoot))
+                    Clear(previousRoot);
+
+                if (HasAnimatedTiles(tilemap))
+                {
+                    Debug.Log($"[TilemapChunkBaker] Skipping {tilemap.name}: has animated tiles");
+                    continue;
+                }
+
+                TilemapChunkRoot root = BakeLayer(tilemap, tilemapRenderer, container);
+                if (root == null) continue;
+
+                layers++;
+                chunkCount += root.chunks.Count;
+                foreach (TileChunk chunk in root.chunks)
+                    tileCount += chunk.tileCount;
+            }
+        }
+
+        EditorUtility.SetDirty(container);
+        Debug.Log($"[TilemapChunkBaker] {scene.name}: {tileCount} tiles in {layers} layers -> {chunkCount} chunk meshes ({assetPath})");
+    }
+
+    public static void Clear(TilemapChunkRoot root)
+    {
+        if (root.sourceRenderer != null)
+        {
+            Undo.RecordObject(root.sourceRenderer, "Clear Tilemap Chunks");
+            root.sourceRenderer.enabled = true;
+        }
+
+        Undo.DestroyObjectImmediate(root.gameObject);
+    }
+
+    static bool HasAnimatedTiles(Tilemap tilemap)
+    {
+        foreach (Vector3Int position in tilemap.cellBounds.allPositionsWithin)
+        {
+            if (tilemap.HasTile(position) && tilemap.GetAnimationFrameCount(position) > 1)
+                return true;
+        }
+        return false;
+    }
+
+    class ChunkBuilder
+    {
+        public List<Vector3> vertices = new List<Vector3>();
+        public List<Vector2> uvs = new List<Vector2>();
+        public List<Color> colors = new List<Color>();
+        public List<int> triangles = new List<int>();
+        public int tileCount;
+    }
+
+    static TilemapChunkRoot BakeLayer(Tilemap tilemap, TilemapRenderer tilemapRenderer, TileChunkAsset container)
+    {
+        tilemap.CompressBounds();
+
+        // Chunk coord + texture -> geometry
+        Dictionary<(Vector2Int, Texture2D), ChunkBuilder> builders = new Dictionary<(Vector2Int, Texture2D), ChunkBuilder>();
+
+        foreach (Vector3Int position in tilemap.cellBounds.allPositionsWithin)
+        {
+            Sprite sprite = tilemap.GetSprite(position);
+            if (sprite == null) continue;
+
+            Vector2Int coord = new Vector2Int(Mathf.FloorToInt((float)position.x / ChunkSize), Mathf.FloorToInt((float)position.y / ChunkSize));
+            var key = (coord, sprite.texture);
+            if (!builders.TryGetValue(key, out ChunkBuilder builder))
+            {
+                builder = new ChunkBuilder();
+                builders[key] = builder;
+            }
+
+            AddTile(tilemap, position, sprite, builder);
+        }
+
+        if (builders.Count == 0) return null;
+
+        GameObject rootObj = new GameObject(RootName);
+        Undo.RegisterCreatedObjectUndo(rootObj, "Bake Tilemap Chunks");
+        rootObj.transform.SetParent(tilemap.transform, false);
+
+        TilemapChunkRoot root = rootObj.AddComponent<TilemapChunkRoot>();
+        root.sourceTilemap = tilemap;
+        root.sourceRenderer = tilemapRenderer;
+        root.chunkSize = ChunkSize;
+
+        Dictionary<Texture2D, Material> materials = new Dictionary<Texture2D, Material>();
+
+        // Stable order so re-bakes produce the same hierarchy
+        List<(Vector2Int, Texture2D)> keys = new List<(Vector2Int, Texture2D)>(builders.Keys);
+        keys.Sort((a, b) => a.Item1.y != b.Item1.y ? a.Item1.y.CompareTo(b.Item1.y) : a.Item1.x.CompareTo(b.Item1.x));
+
+        foreach (var key in keys)
+        {
+            ChunkBuilder builder = builders[key];
+            Vector2Int coord = key.Item1;
+            Texture2D texture = key.Item2;
+
+            Mesh mesh = new Mesh();
+            mesh.name = $"{tilemap.name}_{coord.x}_{coord.y}_{texture.name}";
+            if (builder.vertices.Count > 65535)
+                mesh.indexFormat = IndexFormat.UInt32;
+            mesh.SetVertices(builder.vertices);
+            mesh.SetUVs(0, builder.uvs);
+            mesh.SetColors(builder.colors);
+            mesh.SetTriangles(builder.triangles, 0);
+            mesh.RecalculateBounds();
+            mesh.UploadMeshData(false);
+            AssetDatabase.AddObjectToAsset(mesh, container);
+
+            if (!materials.TryGetValue(texture, out Material material))
+            {
+                // One material per source texture so chunks of a layer batch together
+                material = new Material(tilemapRenderer.sharedMaterial);
+                material.name = $"{tilemap.name}_{texture.name}";
+                material.mainTexture = texture;
+                AssetDatabase.AddObjectToAsset(material, container);
+                materials[texture] = material;
+            }
+
+            GameObject chunkObj = new GameObject($"Chunk_{coord.x}_{coord.y}");
+            chunkObj.transform.SetParent(rootObj.transform, false);
+            chunkObj.AddComponent<MeshFilter>().sharedMesh = mesh;
+
+            MeshRenderer meshRenderer = chunkObj.AddComponent<MeshRenderer>();
+            meshRenderer.sharedMaterial = material;
+            meshRenderer.sortingLayerID = tilemapRenderer.sortingLayerID;
+            meshRenderer.sortingOrder = tilemapRenderer.sortingOrder;
+            meshRenderer.shadowCastingMode = ShadowCastingMode.Off;
+            meshRenderer.receiveShadows = false;
+            meshRenderer.lightProbeUsage = LightProbeUsage.Off;
+            meshRenderer.reflectionProbeUsage = ReflectionProbeUsage.Off;
+
+            root.chunks.Add(new TileChunk
+            {
+                coord = coord,
+                renderer = meshRenderer,
+                bounds = meshRenderer.bounds,
+                tileCount = builder.tileCount
+            });
+
+            container.meshes.Add(mesh);
+        }
+
+        Undo.RecordObject(tilemapRenderer, "Bake Tilemap Chunks");
+        tilemapRenderer.enabled = false;
+
+        return root;
+    }
+
+    // Same placement the TilemapRenderer uses: sprite pivot at cell + tileAnchor, then the tile's matrix
+    static void AddTile(Tilemap tilemap, Vector3Int position, Sprite sprite, ChunkBuilder builder)
+    {
+        Vector3 anchor = tilemap.CellToLocalInterpolated(position + tilemap.tileAnchor);
+        Matrix4x4 tileMatrix = tilemap.GetTransformMatrix(position);
+        Color color = tilemap.GetColor(position) * tilemap.color;
+
+        Vector2[] spriteVertices = sprite.vertices;
+        Vector2[] spriteUVs = sprite.uv;
+        ushort[] spriteTriangles = sprite.triangles;
+        int baseIndex = builder.vertices.Count;
+
+        for (int i = 0; i < spriteVertices.Length; i++)
+        {
+            builder.vertices.Add(anchor + tileMatrix.MultiplyPoint3x4(spriteVertices[i]));
+            builder.uvs.Add(spriteUVs[i]);
+            builder.colors.Add(color);
+        }
+
+        for (int i = 0; i < spriteTriangles.Length; i++)
+        {
+            builder.triangles.Add(baseIndex + spriteTriangles[i]);
+        }
+
+        builder.tileCount++;
+    }
+}
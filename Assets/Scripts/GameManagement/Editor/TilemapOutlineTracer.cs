@@ -0,0 +1,305 @@
+using UnityEngine;
+using UnityEngine.Tilemaps;
+using System.Collections.Generic;
+
+// One 4-connected group of filled tiles with its traced outlines (cell coordinates)
+public class TileRegion
+{
+    public List<Vector2Int> cells = new List<Vector2Int>();
+    public List<List<Vector2>> loops = new List<List<Vector2>>(); // First loop is the outer boundary
+    public bool HasHoles => loops.Count > 1;
+}
+
+// Shared by the shadow, collision and chunk bakers: turns a tilemap into
+// merged outlines instead of one shape per tile
+public static class TilemapOutlineTracer
+{
+    static readonly Vector2Int[] Neighbours = { Vector2Int.right, Vector2Int.up, Vector2Int.left, Vector2Int.down };
+
+    public static HashSet<Vector2Int> GetFilledCells(Tilemap tilemap)
+    {
+        HashSet<Vector2Int> filled = new HashSet<Vector2Int>();
+        BoundsInt bounds = tilemap.cellBounds;
+
+        foreach (Vector3Int position in bounds.allPositionsWithin)
+        {
+            if (tilemap.HasTile(position))
+                filled.Add(new Vector2Int(position.x, position.y));
+        }
+
+        return filled;
+    }
+
+    public static List<TileRegion> TraceRegions(HashSet<Vector2Int> filled)
+    {
+        List<TileRegion> regions = new List<TileRegion>();
+        HashSet<Vector2Int> visited = new HashSet<Vector2Int>();
+        Queue<Vector2Int> queue = new Queue<Vector2Int>();
+
+        foreach (Vector2Int start in filled)
+        {
+            if (visited.Contains(start)) continue;
+
+            // Flood fill one connected region
+            TileRegion region = new TileRegion();
+            HashSet<Vector2Int> regionCells = new HashSet<Vector2Int>();
+            visited.Add(start);
+            queue.Enqueue(start);
+
+            while (queue.Count > 0)
+            {
+                Vector2Int cell = queue.Dequeue();
+                region.cells.Add(cell);
+                regionCells.Add(cell);
+
+                foreach (Vector2Int offset in Neighbours)
+                {
+                    Vector2Int next = cell + offset;
+                    if (filled.Contains(next) && visited.Add(next))
+                        queue.Enqueue(next);
+                }
+            }
+
+            region.loops = TraceLoops(regionCells);
+            regions.Add(region);
+        }
+
+        return regions;
+    }
+
+    // Walks boundary edges into closed loops. Outer loops are counter-clockwise, holes clockwise.
+    public static List<List<Vector2>> TraceLoops(HashSet<Vector2Int> cells)
+    {
+        // Directed boundary edges keyed by start corner, filled cell kept on the left
+        Dictionary<Vector2Int, List<Vector2Int>> edges = new Dictionary<Vector2Int, List<Vector2Int>>();
+
+        foreach (Vector2Int cell in cells)
+        {
+            int x = cell.x;
+            int y = cell.y;
+
+            if (!cells.Contains(new Vector2Int(x, y - 1))) AddEdge(edges, new Vector2Int(x, y), new Vector2Int(x + 1, y));
+            if (!cells.Contains(new Vector2Int(x + 1, y))) AddEdge(edges, new Vector2Int(x + 1, y), new Vector2Int(x + 1, y + 1));
+            if (!cells.Contains(new Vector2Int(x, y + 1))) AddEdge(edges, new Vector2Int(x + 1, y + 1), new Vector2Int(x, y + 1));
+            if (!cells.Contains(new Vector2Int(x - 1, y))) AddEdge(edges, new Vector2Int(x, y + 1), new Vector2Int(x, y));
+        }
+
+        List<List<Vector2>> loops = new List<List<Vector2>>();
+
+        while (edges.Count > 0)
+        {
+            Vector2Int loopStart = FirstKey(edges);
+            Vector2Int current = loopStart;
+            Vector2Int previousDirection = Vector2Int.zero;
+            List<Vector2> loop = new List<Vector2>();
+
+            do
+            {
+                loop.Add(current);
+                Vector2Int next = TakeEdge(edges, current, previousDirection);
+                previousDirection = next - current;
+                current = next;
+            }
+            while (current != loopStart && edges.ContainsKey(current));
+
+            loops.Add(MergeCollinear(loop));
+        }
+
+        // Largest area first = outer boundary
+        loops.Sort((a, b) => Mathf.Abs(SignedArea(b)).CompareTo(Mathf.Abs(SignedArea(a))));
+        return loops;
+    }
+
+    static void AddEdge(Dictionary<Vector2Int, List<Vector2Int>> edges, Vector2Int from, Vector2Int to)
+    {
+        if (!edges.TryGetValue(from, out List<Vector2Int> targets))
+        {
+            targets = new List<Vector2Int>(1);
+            edges[from] = targets;
+        }
+        targets.Add(to);
+    }
+
+    static Vector2Int FirstKey(Dictionary<Vector2Int, List<Vector2Int>> edges)
+    {
+        foreach (Vector2Int key in edges.Keys) return key;
+        return Vector2Int.zero;
+    }
+
+    // At diagonal touch points two edges leave one corner; turn left so loops stay simple
+    static Vector2Int TakeEdge(Dictionary<Vector2Int, List<Vector2Int>> edges, Vector2Int from, Vector2Int previousDirection)
+    {
+        List<Vector2Int> targets = edges[from];
+        int chosen = 0;
+
+        if (targets.Count > 1 && previousDirection != Vector2Int.zero)
+        {
+            Vector2Int left = new Vector2Int(-previousDirection.y, previousDirection.x);
+            for (int i = 0; i < targets.Count; i++)
+            {
+                if (targets[i] - from == left)
+                {
+                    chosen = i;
+                    break;
+                }
+            }
+        }
+
+        Vector2Int to = targets[chosen];
+        targets.RemoveAt(chosen);
+        if (targets.Count == 0)
+            edges.Remove(from);
+
+        return to;
+    }
+
+    // Drops corners that lie on a straight run (grid outlines only ever need this)
+    public static List<Vector2> MergeCollinear(List<Vector2> loop)
+    {
+        List<Vector2> result = new List<Vector2>(loop.Count);
+        int count = loop.Count;
+
+        for (int i = 0; i < count; i++)
+        {
+            Vector2 previous = loop[(i - 1 + count) % count];
+            Vector2 current = loop[i];
+            Vector2 next = loop[(i + 1) % count];
+
+            float cross = (current.x - previous.x) * (next.y - current.y) - (current.y - previous.y) * (next.x - current.x);
+            if (Mathf.Abs(cross) > 0.0001f)
+                result.Add(current);
+        }
+
+        return result;
+    }
+
+    // Douglas-Peucker on a closed loop; tolerance 0 keeps the exact grid outline
+    public static List<Vector2> Simplify(List<Vector2> loop, float tolerance)
+    {
+        if (tolerance <= 0f || loop.Count <= 4) return loop;
+
+        // Split at the vertex farthest from the first to simplify two open chains
+        int farthest = 0;
+        float maxDistance = 0f;
+        for (int i = 1; i < loop.Count; i++)
+        {
+            float distance = (loop[i] - loop[0]).sqrMagnitude;
+            if (distance > maxDistance)
+            {
+                maxDistance = distance;
+                farthest = i;
+            }
+        }
+
+        List<Vector2> first = loop.GetRange(0, farthest + 1);
+        List<Vector2> second = loop.GetRange(farthest, loop.Count - farthest);
+        second.Add(loop[0]);
+
+        List<Vector2> result = SimplifyChain(first, tolerance);
+        result.RemoveAt(result.Count - 1);
+        List<Vector2> secondResult = SimplifyChain(second, tolerance);
+        secondResult.RemoveAt(secondResult.Count - 1);
+        result.AddRange(secondResult);
+
+        return result.Count >= 3 ? result : loop;
+    }
+
+    static List<Vector2> SimplifyChain(List<Vector2> points, float tolerance)
+    {
+        if (points.Count < 3) return new List<Vector2>(points);
+
+        int index = 0;
+        float maxDistance = 0f;
+        Vector2 start = points[0];
+        Vector2 end = points[points.Count - 1];
+
+        for (int i = 1; i < points.Count - 1; i++)
+        {
+            float distance = DistanceToSegment(points[i], start, end);
+            if (distance > maxDistance)
+            {
+                maxDistance = distance;
+                index = i;
+            }
+        }
+
+        if (maxDistance <= tolerance)
+            return new List<Vector2> { start, end };
+
+        List<Vector2> left = SimplifyChain(points.GetRange(0, index + 1), tolerance);
+        List<Vector2> right = SimplifyChain(points.GetRange(index, points.Count - index), tolerance);
+        left.RemoveAt(left.Count - 1);
+        left.AddRange(right);
+        return left;
+    }
+
+    static float DistanceToSegment(Vector2 point, Vector2 a, Vector2 b)
+    {
+        Vector2 ab = b - a;
+        float lengthSquared = ab.sqrMagnitude;
+        if (lengthSquared < 0.000001f) return Vector2.Distance(point, a);
+
+        float t = Mathf.Clamp01(Vector2.Dot(point - a, ab) / lengthSquared);
+        return Vector2.Distance(point, a + ab * t);
+    }
+
+    // Greedy rectangle cover, used where a region has holes and can't be one polygon
+    public static List<RectInt> GreedyRectangles(List<Vector2Int> cells)
+    {
+        HashSet<Vector2Int> remaining = new HashSet<Vector2Int>(cells);
+        List<Vector2Int> ordered = new List<Vector2Int>(cells);
+        ordered.Sort((a, b) => a.y != b.y ? a.y.CompareTo(b.y) : a.x.CompareTo(b.x));
+
+        List<RectInt> rects = new List<RectInt>();
+
+        foreach (Vector2Int start in ordered)
+        {
+            if (!remaining.Contains(start)) continue;
+
+            int width = 1;
+            while (remaining.Contains(new Vector2Int(start.x + width, start.y)))
+                width++;
+
+            int height = 1;
+            bool canGrow = true;
+            while (canGrow)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    if (!remaining.Contains(new Vector2Int(start.x + x, start.y + height)))
+                    {
+                        canGrow = false;
+                        break;
+                    }
+                }
+                if (canGrow) height++;
+            }
+
+            for (int y = 0; y < height; y++)
+                for (int x = 0; x < width; x++)
+                    remaining.Remove(new Vector2Int(start.x + x, start.y + y));
+
+            rects.Add(new RectInt(start.x, start.y, width, height));
+        }
+
+        return rects;
+    }
+
+    public static float SignedArea(List<Vector2> loop)
+    {
+        float area = 0f;
+        for (int i = 0; i < loop.Count; i++)
+        {
+            Vector2 a = loop[i];
+            Vector2 b = loop[(i + 1) % loop.Count];
+            area += a.x * b.y - b.x * a.y;
+        }
+        return area * 0.5f;
+    }
+
+    // Cell-space corner to tilemap local space (honours cell size and gaps)
+    public static Vector2 CellToLocal(Tilemap tilemap, Vector2 cellCorner)
+    {
+        return tilemap.CellToLocalInterpolated(new Vector3(cellCorner.x, cellCorner.y, 0f));
+    }
+}
@@ -0,0 +1,58 @@
+using UnityEngine;
+
+// Fixed-tick movement for NPCs (Emily etc). AI code sets a desired velocity from
+// Update; it is applied on the simulation tick and rendered interpolated.
+[RequireComponent(typeof(Rigidbody2D))]
+public class FixedStepMover : MonoBehaviour
+{
+    [Header("Movement")]
+    public float moveSpeed = 3f;
+    public bool useInterpolation = true;
+
+    private Rigidbody2D rb;
+    private Vector2 desiredVelocity = Vector2.zero;
+
+    public Vector2 DesiredVelocity => desiredVelocity;
+    public bool IsMoving => desiredVelocity.sqrMagnitude > 0.0001f;
+
+    void Awake()
+    {
+        rb = GetComponent<Rigidbody2D>();
+
+        if (useInterpolation)
+            rb.interpolation = RigidbodyInterpolation2D.Interpolate;
+    }
+
+    void OnEnable()
+    {
+        SimulationTickManager.Instance?.Register(rb);
+    }
+
+    void OnDisable()
+    {
+        if (SimulationTickManager.HasInstance)
+        {
+            SimulationTickManager.Instance.Unregister(rb);
+        }
+
+        desiredVelocity = Vector2.zero;
+        if (rb != null)
+            rb.linearVelocity = Vector2.zero;
+    }
+
+    // Direction is normalized by the caller or clamped here
+    public void Move(Vector2 direction)
+    {
+        desiredVelocity = Vector2.ClampMagnitude(direction, 1f) * moveSpeed;
+    }
+
+    public void Stop()
+    {
+        desiredVelocity = Vector2.zero;
+    }
+
+    void FixedUpdate()
+    {
+        rb.linearVelocity = desiredVelocity;
+    }
+}
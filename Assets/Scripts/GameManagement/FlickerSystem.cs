@@ -0,0 +1,171 @@
+using UnityEngine;
+using UnityEngine.Rendering.Universal;
+using System.Collections.Generic;
+
+// One flickering light. Geometry (radius/range) stays fixed; only intensity
+// and optionally falloff strength change, so URP never rebuilds the light mesh.
+public class FlickerEntry
+{
+    public Light2D light2D;
+    public Light legacyLight;
+    public float baseIntensity;
+    public float intensityVariation;
+    public float baseFalloff;
+    public float falloffVariation; // Point light falloff strength (shader parameter, no mesh rebuild)
+    public float speed;
+    public float phase;
+}
+
+// Drives every flickering light in one Update from a precomputed looping noise table
+public class FlickerSystem : PersistentSingleton<FlickerSystem>
+{
+    public const int TableSize = 256;
+    private const float TablePeriod = 64f; // Noise units before the table loops
+
+    [Header("Noise")]
+    public float noiseSeed = 37f;
+
+    [Header("Update Rate")]
+    public float updateRate = 0f; // Updates per second, 0 = every frame (set by QualityGovernor)
+
+    private static float[] noiseTable;
+    private List<FlickerEntry> entries = new List<FlickerEntry>();
+    private float time;
+    private float updateTimer;
+
+    public int Count => entries.Count;
+
+    protected override void OnSingletonAwake()
+    {
+        BuildNoiseTable(noiseSeed);
+
+        QualityGovernor.OnQualityChanged += ApplyQuality;
+        if (QualityGovernor.Current != null)
+            ApplyQuality(QualityGovernor.Current);
+    }
+
+    void ApplyQuality(QualityTier tier)
+    {
+        updateRate = tier.flickerRate;
+    }
+
+    // Perlin noise sampled around a circle so the table loops without a seam
+    static void BuildNoiseTable(float seed)
+    {
+        noiseTable = new float[TableSize];
+        float radius = TablePeriod / (2f * Mathf.PI);
+
+        for (int i = 0; i < TableSize; i++)
+        {
+            float angle = i * 2f * Mathf.PI / TableSize;
+            noiseTable[i] = Mathf.PerlinNoise(seed + Mathf.Cos(angle) * radius, seed + Mathf.Sin(angle) * radius);
+        }
+    }
+
+    // Looping noise in 0..1, one feature per unit like Mathf.PerlinNoise(t, 0)
+    public static float SampleNoise(float position)
+    {
+        float index = position * (TableSize / TablePeriod);
+        index -= Mathf.Floor(index / TableSize) * TableSize;
+
+        int i0 = (int)index;
+        int i1 = (i0 + 1) % TableSize;
+        return Mathf.Lerp(noiseTable[i0], noiseTable[i1], index - i0);
+    }
+
+    public FlickerEntry Register(Light2D light, float baseIntensity, float intensityVariation, float speed, float falloffVariation = 0f)
+    {
+        if (light == null) return null;
+
+        FlickerEntry entry = new FlickerEntry
+        {
+            light2D = light,
+            baseIntensity = baseIntensity,
+            intensityVariation = intensityVariation,
+            baseFalloff = light.falloffIntensity,
+            falloffVariation = falloffVariation,
+            speed = speed,
+            phase = Random.Range(0f, TablePeriod)
+        };
+
+        // Budgeted lights fade via weight instead of the optimizer writing intensity
+        LightingOptimizer.SetExternallyDriven(light, true);
+
+        entries.Add(entry);
+        return entry;
+    }
+
+    public FlickerEntry Register(Light light, float baseIntensity, float intensityVariation, float speed)
+    {
+        if (light == null) return null;
+
+        FlickerEntry entry = new FlickerEntry
+        {
+            legacyLight = light,
+            baseIntensity = baseIntensity,
+            intensityVariation = intensityVariation,
+            speed = speed,
+            phase = Random.Range(0f, TablePeriod)
+        };
+
+        entries.Add(entry);
+        return entry;
+    }
+
+    public void Unregister(FlickerEntry entry)
+    {
+        if (entry == null) return;
+
+        entries.Remove(entry);
+        LightingOptimizer.SetExternallyDriven(entry.light2D, false);
+    }
+
+    void Update()
+    {
+        time += Time.deltaTime;
+
+        // Lower tiers flicker at a fixed rate instead of every frame
+        if (updateRate > 0f)
+        {
+            updateTimer += Time.deltaTime;
+            if (updateTimer < 1f / updateRate) return;
+            updateTimer = 0f;
+        }
+
+        for (int i = entries.Count - 1; i >= 0; i--)
+        {
+            FlickerEntry entry = entries[i];
+            float position = time * entry.speed + entry.phase;
+
+            if (entry.light2D != null)
+            {
+                if (!entry.light2D.enabled) continue;
+
+                // 1 unless a BudgetedLight2D on the light is fading it
+                float weight = LightingOptimizer.GetWeight(entry.light2D);
+                entry.light2D.intensity = (entry.baseIntensity + SampleNoise(position) * entry.intensityVariation) * weight;
+
+                if (entry.falloffVariation != 0f)
+                {
+                    // Offset into the table so falloff doesn't move in lockstep with intensity
+                    entry.light2D.falloffIntensity = Mathf.Clamp01(entry.baseFalloff - SampleNoise(position + TablePeriod * 0.5f) * entry.falloffVariation);
+                }
+            }
+            else if (entry.legacyLight != null)
+            {
+                entry.legacyLight.intensity = entry.baseIntensity + SampleNoise(position) * entry.intensityVariation;
+            }
+            else
+            {
+                // Light destroyed without unregistering
+                entries.RemoveAt(i);
+            }
+        }
+    }
+
+    protected override void OnSingletonDestroy()
+    {
+        QualityGovernor.OnQualityChanged -= ApplyQuality;
+        entries.Clear();
+    }
+}
@@ -0,0 +1,32 @@
+using UnityEngine;
+
+// Decorative bob/spin for props - animated in batch by ItemAnimationSystem
+public class FloatingDecoration : MonoBehaviour
+{
+    [Header("Animation")]
+    public float bobAmount = 0.25f;
+    public float bobSpeed = 1.5f;
+    public float rotationSpeed = 0f;
+
+    private Vector3 startPosition;
+    private bool hasStartPosition = false;
+
+    void OnEnable()
+    {
+        if (!hasStartPosition)
+        {
+            startPosition = transform.position;
+            hasStartPosition = true;
+        }
+
+        ItemAnimationSystem.Instance?.Register(transform, startPosition, bobAmount, bobSpeed, rotationSpeed);
+    }
+
+    void OnDisable()
+    {
+        if (ItemAnimationSystem.HasInstance)
+        {
+            ItemAnimationSystem.Instance.Unregister(transform);
+        }
+    }
+}
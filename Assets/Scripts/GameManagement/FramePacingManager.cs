@@ -0,0 +1,204 @@
+using UnityEngine;
+using UnityEngine.Rendering;
+using System.Collections.Generic;
+
+// Drops the render rate behind static screens (pause, save menu, fully typed dialogue)
+// and bumps back to full rate on input or animation. Tracks frames skipped and
+// battery drain per state so the savings can be measured on device.
+public class FramePacingManager : PersistentSingleton<FramePacingManager>
+{
+    [Header("Active")]
+    public int activeTargetFrameRate = 0; // 0 keeps whatever the game started with (project or platform default)
+
+    [Header("Idle")]
+    public int idleTargetFrameRate = 30;
+    public int idleRenderFrameInterval = 3; // Render every Nth frame while idle (10 fps at 30)
+
+    [Header("Wake")]
+    public float wakeDuration = 0.5f; // Full rate kept this long after input or animation
+
+    [Header("Debug")]
+    public bool logStateChanges = false;
+
+    private HashSet<string> idleReasons = new HashSet<string>();
+    private float wakeTimer;
+    private bool isIdle = false;
+    private Vector3 lastMousePosition;
+
+    // Stats
+    private int renderedFrames;
+    private int skippedFrames;
+    private float activeSeconds;
+    private float idleSeconds;
+    private float activeBatteryDrain;
+    private float idleBatteryDrain;
+    private float lastBatteryLevel = -1f;
+
+    public bool IsIdle => isIdle;
+
+    // Frame rate the active state actually runs at
+    public float ActiveFrameRate => EffectiveFrameRate(activeTargetFrameRate);
+    public int RenderedFrames => renderedFrames;
+    public int SkippedFrames => skippedFrames;
+
+    protected override void OnSingletonAwake()
+    {
+        // Restoring the startup rate keeps 90/120 Hz devices at their full rate
+        if (activeTargetFrameRate == 0)
+            activeTargetFrameRate = Application.targetFrameRate;
+
+        lastMousePosition = Input.mousePosition;
+        lastBatteryLevel = SystemInfo.batteryLevel;
+        ApplyPacing(false);
+    }
+
+    // Each system asks for idle pacing under its own reason and releases it when done
+    public void RequestIdle(string reason)
+    {
+        idleReasons.Add(reason);
+    }
+
+    public void ReleaseIdle(string reason)
+    {
+        if (idleReasons.Remove(reason))
+        {
+            Wake();
+        }
+    }
+
+    // Call when something on screen animates (menu transitions, fades)
+    public void Wake(float duration = -1f)
+    {
+        wakeTimer = Mathf.Max(wakeTimer, duration >= 0f ? duration : wakeDuration);
+    }
+
+    void Update()
+    {
+        float deltaTime = Time.unscaledDeltaTime;
+
+        if (HasInput())
+        {
+            Wake();
+        }
+
+        if (wakeTimer > 0f)
+        {
+            wakeTimer -= deltaTime;
+        }
+
+        bool shouldIdle = idleReasons.Count > 0 && wakeTimer <= 0f;
+        if (shouldIdle != isIdle)
+        {
+            ApplyPacing(shouldIdle);
+        }
+
+        UpdateStats(deltaTime);
+    }
+
+    bool HasInput()
+    {
+        bool mouseMoved = Input.mousePosition != lastMousePosition;
+        lastMousePosition = Input.mousePosition;
+
+        return Input.anyKey || Input.touchCount > 0 || mouseMoved || Input.mouseScrollDelta != Vector2.zero;
+    }
+
+    void ApplyPacing(bool idle)
+    {
+        isIdle = idle;
+
+        if (idle)
+        {
+            Application.targetFrameRate = idleTargetFrameRate;
+            OnDemandRendering.renderFrameInterval = Mathf.Max(1, idleRenderFrameInterval);
+        }
+        else
+        {
+            Application.targetFrameRate = activeTargetFrameRate;
+            OnDemandRendering.renderFrameInterval = 1;
+        }
+
+        if (logStateChanges)
+        {
+            Debug.Log($"[FramePacing] {(idle ? "Idle" : "Active")} - target {Application.targetFrameRate} fps, " +
+                      $"render every {OnDemandRendering.renderFrameInterval} frame(s)");
+        }
+    }
+
+    void UpdateStats(float deltaTime)
+    {
+        if (OnDemandRendering.willCurrentFrameRender)
+            renderedFrames++;
+        else
+            skippedFrames++;
+
+        float batteryLevel = SystemInfo.batteryLevel;
+        float drain = 0f;
+
+        // Battery level is -1 when unsupported (editor/desktop)
+        if (batteryLevel >= 0f && lastBatteryLevel >= 0f && SystemInfo.batteryStatus == BatteryStatus.Discharging)
+        {
+            drain = Mathf.Max(0f, lastBatteryLevel - batteryLevel);
+        }
+        lastBatteryLevel = batteryLevel;
+
+        if (isIdle)
+        {
+            idleSeconds += deltaTime;
+            idleBatteryDrain += drain;
+        }
+        else
+        {
+            activeSeconds += deltaTime;
+            activeBatteryDrain += drain;
+        }
+    }
+
+    // What a targetFrameRate value delivers. -1 is the platform default: 30 fps on phones,
+    // the display's refresh rate elsewhere. Desktop vsync overrides the target.
+    public static float EffectiveFrameRate(int targetFrameRate)
+    {
+        float refreshRate = (float)Screen.currentResolution.refreshRateRatio.value;
+        if (refreshRate <= 0f)
+            refreshRate = 60f;
+
+        if (!Application.isMobilePlatform && QualitySettings.vSyncCount > 0)
+            return refreshRate / QualitySettings.vSyncCount;
+
+        if (targetFrameRate > 0)
+            return targetFrameRate;
+
+        return Application.isMobilePlatform ? 30f : refreshRate;
+    }
+
+    // Battery percent per hour spent in each state
+    public float GetActiveDrainPerHour() => activeSeconds > 0f ? activeBatteryDrain * 100f * 3600f / activeSeconds : 0f;
+    public float GetIdleDrainPerHour() => idleSeconds > 0f ? idleBatteryDrain * 100f * 3600f / idleSeconds : 0f;
+
+    [ContextMenu("Log Pacing Report")]
+    public void LogReport()
+    {
+        int totalFrames = renderedFrames + skippedFrames;
+        float skippedPercent = totalFrames > 0 ? skippedFrames * 100f / totalFrames : 0f;
+
+        Debug.Log($"[FramePacing] Frames rendered: {renderedFrames}, skipped: {skippedFrames} ({skippedPercent:F1}%)");
+        Debug.Log($"[FramePacing] Active: {activeSeconds:F0}s ({GetActiveDrainPerHour():F1}%/h battery), " +
+                  $"Idle: {idleSeconds:F0}s ({GetIdleDrainPerHour():F1}%/h battery)");
+    }
+
+    [ContextMenu("Reset Pacing Stats")]
+    public void ResetStats()
+    {
+        renderedFrames = 0;
+        skippedFrames = 0;
+        activeSeconds = 0f;
+        idleSeconds = 0f;
+        activeBatteryDrain = 0f;
+        idleBatteryDrain = 0f;
+    }
+
+    protected override void OnSingletonDestroy()
+    {
+        OnDemandRendering.renderFrameInterval = 1;
+    }
+}
@@ -0,0 +1,275 @@
+using UnityEngine;
+using UnityEngine.Audio;
+using UnityEngine.SceneManagement;
+using System.Collections;
+using System.Collections.Generic;
+using System.IO;
+using System.Threading.Tasks;
+
+// Lives alone in the Bootstrap scene (build index 0). Brings the game up through an
+// explicit graph of steps instead of whatever order Awake/Start happen to run in:
+// a step starts as soon as everything it depends on has finished, so independent
+// steps (the save read on a worker thread, the room streaming in, persistent
+// services) overlap. Every step is timed into a StartupReport.
+public class GameBootstrap : MonoBehaviour
+{
+    [Header("Startup")]
+    public string defaultRoom = "Room01_Foyer"; // New game, or no save to continue
+    public int continueSlot = 1;
+    public bool resumeSavedRoom = true;
+
+    [Header("Audio")]
+    public AudioMixer audioMixer; // Handed to AudioVoiceManager so nothing scans for it
+
+    [Header("Report")]
+    public string reportFileName = "startup_report.json";
+    public bool logReport = true;
+
+    [Header("Debug")]
+    public bool profileUIRebuilds = true; // Development builds and the editor only
+
+    class Step
+    {
+        public string name;
+        public string[] dependsOn;
+        public System.Func<IEnumerator> run;
+        public StartupPhase phase;
+        public bool started;
+        public bool done;
+    }
+
+    private readonly List<Step> steps = new List<Step>();
+    private readonly Dictionary<string, Step> stepsByName = new Dictionary<string, Step>();
+    private readonly StartupReport report = new StartupReport();
+
+    private GameSaveData loadedSave;
+    private string firstRoom;
+    private AsyncOperation roomLoad;
+
+    void Awake()
+    {
+        report.engineInitMs = StartupReport.NowMs;
+
+        // Survives the room replacing this scene, to time the first interactive frame
+        DontDestroyOnLoad(gameObject);
+
+        AddStep("Services", CreateServices);
+        AddStep("SaveRead", ReadSave);
+        AddStep("RoomLoad", LoadRoom, "SaveRead", "Services");
+        AddStep("RoomActivate", ActivateRoom, "RoomLoad", "Services");
+        AddStep("FirstFrame", WaitForFirstFrame, "RoomActivate");
+    }
+
+    void Start()
+    {
+        if (!Validate())
+        {
+            Debug.LogError($"[GameBootstrap] Invalid startup graph - loading {defaultRoom} directly");
+            SceneManager.LoadScene(defaultRoom);
+            Destroy(gameObject);
+            return;
+        }
+
+        StartCoroutine(RunGraph());
+    }
+
+    void AddStep(string stepName, System.Func<IEnumerator> run, params string[] dependsOn)
+    {
+        Step step = new Step { name = stepName, run = run, dependsOn = dependsOn };
+        steps.Add(step);
+        stepsByName.Add(stepName, step);
+    }
+
+    // Every dependency exists and the graph has no cycles
+    bool Validate()
+    {
+        Dictionary<string, int> state = new Dictionary<string, int>(); // 1 visiting, 2 done
+        foreach (Step step in steps)
+        {
+            if (!Visit(step, state))
+                return false;
+        }
+        return true;
+    }
+
+    bool Visit(Step step, Dictionary<string, int> state)
+    {
+        state.TryGetValue(step.name, out int visited);
+        if (visited == 2) return true;
+        if (visited == 1)
+        {
+            Debug.LogError($"[GameBootstrap] Dependency cycle through {step.name}");
+            return false;
+        }
+
+        state[step.name] = 1;
+        foreach (string dependency in step.dependsOn)
+        {
+            if (!stepsByName.TryGetValue(dependency, out Step required))
+            {
+                Debug.LogError($"[GameBootstrap] {step.name} depends on unknown step {dependency}");
+                return false;
+            }
+            if (!Visit(required, state))
+                return false;
+        }
+        state[step.name] = 2;
+        return true;
+    }
+
+    IEnumerator RunGraph()
+    {
+        int remaining = steps.Count;
+
+        while (remaining > 0)
+        {
+            // Steps are checked in declaration order, so ties always start the same way
+            foreach (Step step in steps)
+            {
+                if (step.started || !DependenciesDone(step)) continue;
+
+                step.started = true;
+                StartCoroutine(RunStep(step));
+            }
+
+            yield return null;
+
+            remaining = 0;
+            foreach (Step step in steps)
+            {
+                if (!step.done)
+                    remaining++;
+            }
+        }
+
+        report.firstRoom = firstRoom;
+        report.firstInteractiveMs = StartupReport.NowMs;
+        report.Write(reportFileName);
+
+        if (logReport)
+            Debug.Log(report.ToString());
+
+        Destroy(gameObject);
+    }
+
+    bool DependenciesDone(Step step)
+    {
+        foreach (string dependency in step.dependsOn)
+        {
+            if (!stepsByName[dependency].done)
+                return false;
+        }
+        return true;
+    }
+
+    IEnumerator RunStep(Step step)
+    {
+        step.phase = report.AddPhase(step.name, step.dependsOn);
+        yield return step.run();
+        step.phase.endMs = StartupReport.NowMs;
+        step.done = true;
+    }
+
+    // Steps
+
+    // Persistent singletons, created in a fixed order rather than on first use mid-frame
+    IEnumerator CreateServices()
+    {
+        // Inactive until the mixer is assigned, so its Awake routes voices without searching
+        if (!AudioVoiceManager.HasInstance)
+        {
+            GameObject voiceObj = new GameObject("AudioVoiceManager");
+            voiceObj.SetActive(false);
+            voiceObj.AddComponent<AudioVoiceManager>().mixer = audioMixer;
+            voiceObj.SetActive(true);
+        }
+
+        // The rest are lazy singletons; touching Instance creates them
+        _ = FramePacingManager.Instance;
+        _ = VideoSettingsVolume.Instance;
+        _ = TweenScheduler.Instance;
+        _ = RoomAudioManager.Instance;
+        _ = RoomBundleManager.Instance;
+        _ = RoomStreamingManager.Instance; // Before the room, so it adopts it and preloads neighbours
+
+#if DEVELOPMENT_BUILD || UNITY_EDITOR
+        // Reads UGUI's private rebuild queues, so it never ships in release
+        if (profileUIRebuilds)
+        {
+            GameObject profilerObj = new GameObject("UIRebuildProfiler");
+            DontDestroyOnLoad(profilerObj);
+            profilerObj.AddComponent<UIRebuildProfiler>();
+        }
+#endif
+        yield break;
+    }
+
+    // Reads and parses the continue slot on a worker thread; SaveSystem adopts it
+    IEnumerator ReadSave()
+    {
+        string filePath = SaveSystem.GetSaveFilePath(continueSlot);
+
+        Task<GameSaveData> read = Task.Run(() =>
+        {
+            if (!File.Exists(filePath)) return null;
+            // JsonUtility is safe off the main thread for plain data classes
+            return JsonUtility.FromJson<GameSaveData>(File.ReadAllText(filePath));
+        });
+
+        while (!read.IsCompleted)
+            yield return null;
+
+        if (read.IsFaulted)
+        {
+            Debug.LogWarning($"[GameBootstrap] Failed to read save slot {continueSlot}: {read.Exception.GetBaseException().Message}");
+            stepsByName["SaveRead"].phase.failed = true;
+        }
+        else
+        {
+            loadedSave = read.Result;
+        }
+
+        SaveSystem.ProvidePreloadedSave(continueSlot, loadedSave);
+    }
+
+    // Streams the room in but holds activation until the rest of the graph is ready
+    IEnumerator LoadRoom()
+    {
+        RoomBundleManager bundles = RoomBundleManager.Instance;
+
+        firstRoom = defaultRoom;
+        if (resumeSavedRoom && loadedSave != null && !string.IsNullOrEmpty(loadedSave.currentScene)
+            && (Application.CanStreamedLevelBeLoaded(loadedSave.currentScene) || bundles.HasRoom(loadedSave.currentScene)))
+        {
+            firstRoom = loadedSave.currentScene;
+        }
+
+        // A room shipped as a bundle needs its bundles in memory before the scene can load;
+        // RoomStreamingManager takes over the reference when the room starts
+        bundles.Acquire(firstRoom);
+        while (!bundles.IsReady(firstRoom))
+            yield return null;
+
+        roomLoad = SceneManager.LoadSceneAsync(firstRoom);
+        roomLoad.allowSceneActivation = false;
+
+        // Activation is held back at 0.9
+        while (roomLoad.progress < 0.9f)
+            yield return null;
+    }
+
+    IEnumerator ActivateRoom()
+    {
+        roomLoad.allowSceneActivation = true;
+
+        while (!roomLoad.isDone)
+            yield return null;
+    }
+
+    // Awake/Start of the room have run; the frame after is the first one the player acts in
+    IEnumerator WaitForFirstFrame()
+    {
+        yield return null;
+        yield return new WaitForEndOfFrame();
+    }
+}
@@ -0,0 +1,150 @@
+using UnityEngine;
+using UnityEngine.Jobs;
+using System.Collections.Generic;
+using Unity.Burst;
+using Unity.Collections;
+using Unity.Jobs;
+using Unity.Mathematics;
+
+// Per-transform animation settings, kept parallel to the TransformAccessArray
+public struct ItemAnimationData
+{
+    public float3 startPosition;
+    public quaternion startRotation;
+    public float bobAmount;
+    public float bobSpeed;
+    public float rotationSpeed; // Degrees per second around local up
+    public float spinStartTime;
+}
+
+[BurstCompile]
+public struct ItemAnimationJob : IJobParallelForTransform
+{
+    [ReadOnly] public NativeArray<ItemAnimationData> items;
+    public float time;
+
+    public void Execute(int index, TransformAccess transform)
+    {
+        ItemAnimationData item = items[index];
+
+        // Bob up and down
+        float bobOffset = math.sin(time * item.bobSpeed) * item.bobAmount;
+        transform.position = item.startPosition + new float3(0f, bobOffset, 0f);
+
+        // Rotate slowly (same as transform.Rotate(Vector3.up, ...) accumulated every frame)
+        float angle = math.radians(item.rotationSpeed * (time - item.spinStartTime));
+        transform.rotation = math.mul(item.startRotation, quaternion.AxisAngle(math.up(), angle));
+    }
+}
+
+public class ItemAnimationSystem : PersistentSingleton<ItemAnimationSystem>
+{
+    [Header("Settings")]
+    public int initialCapacity = 64;
+
+    private TransformAccessArray transforms;
+    private NativeList<ItemAnimationData> items;
+    private List<Transform> registered = new List<Transform>();
+    private Dictionary<Transform, int> indexLookup = new Dictionary<Transform, int>();
+    private JobHandle animationHandle;
+    private bool jobScheduled = false;
+
+    public int Count => registered.Count;
+
+    protected override void OnSingletonAwake()
+    {
+        transforms = new TransformAccessArray(initialCapacity);
+        items = new NativeList<ItemAnimationData>(initialCapacity, Allocator.Persistent);
+    }
+
+    public void Register(Transform target, float bobAmount, float bobSpeed, float rotationSpeed)
+    {
+        Register(target, target.position, bobAmount, bobSpeed, rotationSpeed);
+    }
+
+    public void Register(Transform target, Vector3 startPosition, float bobAmount, float bobSpeed, float rotationSpeed)
+    {
+        if (target == null || indexLookup.ContainsKey(target)) return;
+
+        CompleteAnimation();
+
+        indexLookup[target] = registered.Count;
+        registered.Add(target);
+        transforms.Add(target);
+        items.Add(new ItemAnimationData
+        {
+            startPosition = startPosition,
+            startRotation = target.rotation,
+            bobAmount = bobAmount,
+            bobSpeed = bobSpeed,
+            rotationSpeed = rotationSpeed,
+            spinStartTime = Time.time
+        });
+    }
+
+    public void Unregister(Transform target)
+    {
+        if (target == null || !indexLookup.TryGetValue(target, out int index)) return;
+
+        CompleteAnimation();
+
+        // Swap-back removal keeps all three collections in the same order
+        int lastIndex = registered.Count - 1;
+        Transform last = registered[lastIndex];
+
+        registered[index] = last;
+        registered.RemoveAt(lastIndex);
+        transforms.RemoveAtSwapBack(index);
+        items.RemoveAtSwapBack(index);
+
+        indexLookup.Remove(target);
+        if (last != target)
+        {
+            indexLookup[last] = index;
+        }
+    }
+
+    public bool IsRegistered(Transform target)
+    {
+        return target != null && indexLookup.ContainsKey(target);
+    }
+
+    void Update()
+    {
+        if (registered.Count == 0) return;
+
+        ItemAnimationJob job = new ItemAnimationJob
+        {
+            items = items.AsArray(),
+            time = Time.time
+        };
+
+        // Runs on worker threads while the rest of Update executes
+        animationHandle = job.Schedule(transforms);
+        jobScheduled = true;
+    }
+
+    void LateUpdate()
+    {
+        CompleteAnimation();
+    }
+
+    void CompleteAnimation()
+    {
+        if (!jobScheduled) return;
+
+        animationHandle.Complete();
+        jobScheduled = false;
+    }
+
+    protected override void OnSingletonDestroy()
+    {
+        CompleteAnimation();
+
+        if (transforms.isCreated)
+            transforms.Dispose();
+
+        if (items.IsCreated)
+            items.Dispose();
+    }
+}
@@ -0,0 +1,92 @@
+using UnityEngine;
+using System.Collections;
+
+// A menu panel prefab under Resources that is only loaded the first time it's opened,
+// instead of shipping (and staying resident) in every room scene. Once it has been
+// closed for a while the instance is destroyed and the prefab reference dropped, so the
+// next Resources.UnloadUnusedAssets (every scene change) frees its textures and fonts.
+public class LazyMenuPanel<T> where T : Component
+{
+    private readonly string resourcePath;
+    private readonly Transform parent;
+    private float closedSince = -1f; // < 0 while open or never opened
+
+    public T View { get; private set; }
+    public bool IsLoading { get; private set; }
+    public bool IsLoaded => View != null;
+
+    public LazyMenuPanel(string resourcePath, Transform parent)
+    {
+        this.resourcePath = resourcePath;
+        this.parent = parent;
+    }
+
+    // Yields until View is set (or the prefab turned out to be missing)
+    public IEnumerator Load()
+    {
+        if (View != null) yield break;
+
+        // Another caller already started the load
+        if (IsLoading)
+        {
+            while (IsLoading)
+                yield return null;
+            yield break;
+        }
+
+        IsLoading = true;
+        float startTime = Time.realtimeSinceStartup;
+
+        ResourceRequest request = Resources.LoadAsync<GameObject>(resourcePath);
+        yield return request;
+
+        GameObject prefab = request.asset as GameObject;
+        if (prefab == null || prefab.GetComponent<T>() == null)
+        {
+            Debug.LogError($"[LazyMenuPanel] No {typeof(T).Name} prefab at Resources/{resourcePath}");
+            IsLoading = false;
+            yield break;
+        }
+
+        // Prefab root is saved inactive, so the panel stays hidden until the caller binds it
+        GameObject panelObj = Object.Instantiate(prefab, parent, false);
+        panelObj.name = prefab.name;
+        View = panelObj.GetComponent<T>();
+        IsLoading = false;
+
+        Debug.Log($"[LazyMenuPanel] Loaded {resourcePath} in {(Time.realtimeSinceStartup - startTime) * 1000f:F0} ms");
+    }
+
+    public void MarkOpen()
+    {
+        closedSince = -1f;
+    }
+
+    public void MarkClosed()
+    {
+        if (View != null && closedSince < 0f)
+            closedSince = Time.unscaledTime;
+    }
+
+    // Returns true if the panel was released
+    public bool ReleaseIfIdle(float seconds)
+    {
+        if (View == null || closedSince < 0f) return false;
+        if (Time.unscaledTime - closedSince < seconds) return false;
+
+        Release();
+        return true;
+    }
+
+    public void Release()
+    {
+        if (View != null)
+        {
+            Object.Destroy(View.gameObject);
+            Debug.Log($"[LazyMenuPanel] Released {resourcePath}");
+        }
+
+        View = null;
+        closedSince = -1f;
+    }
+}
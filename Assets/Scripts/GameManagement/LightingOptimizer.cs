@@ -1,39 +1,431 @@
 using UnityEngine;
+using UnityEngine.Rendering;
+using UnityEngine.Rendering.Universal;
+using System.Collections;
+using System.Collections.Generic;
+using System.Reflection;
 
+// Runtime state for one Light2D under the light budget
+public class BudgetedLightState
+{
+    public Light2D light;
+    public float baseIntensity;
+    public float weight;          // 0..1 fade applied on top of baseIntensity
+    public bool alwaysOn;         // Player candle, global lights
+    public bool externallyDriven; // Another script writes intensity (flicker) and reads weight
+    public bool wanted;
+    public float score;
+    public Vector2Int cell;
+    public bool inGrid;
+    public bool castsShadows;     // Authored setting, restored when the quality tier allows shadows
+}
+
+// Light2D budget: lights register themselves, get ranked by on-screen contribution and
+// distance, and only the top maxLights stay on. Ranking runs at rerankInterval;
+// fades run every frame so lights don't pop.
 public class LightingOptimizer : MonoBehaviour
 {
     [Header("Performance")]
     public int maxLights = 3; // Limit active lights
     public float cullingDistance = 15f;
 
-    private Light[] sceneLights;
+    [Header("Ranking")]
+    public float rerankInterval = 0.25f;
+    public float hysteresisBonus = 1.25f; // Currently-lit lights win close ties
+    public float gridCellSize = 8f;
+
+    [Header("Fading")]
+    public float fadeDuration = 0.35f;
+
+    [Header("Stats (Renderer2D cull results)")]
+    public Renderer2DData rendererData; // Assign Renderer2D.asset to read per-frame light counts
+
+    [Header("Adaptive Quality")]
+    public bool adaptiveQuality = true; // Budget, culling distance and shadows follow QualityGovernor
+
+    // Registry is static so lights can register before the optimizer wakes up
+    private static readonly List<BudgetedLightState> registry = new List<BudgetedLightState>();
+    private static readonly Dictionary<Light2D, BudgetedLightState> lookup = new Dictionary<Light2D, BudgetedLightState>();
+    private static readonly HashSet<Light2D> drivenLights = new HashSet<Light2D>(); // Intensity owned by FlickerSystem
+    private static bool shadowsAllowed = true;
+
+    private Dictionary<Vector2Int, List<BudgetedLightState>> grid = new Dictionary<Vector2Int, List<BudgetedLightState>>();
+    private List<BudgetedLightState> candidates = new List<BudgetedLightState>();
     private Transform player;
+    private Camera mainCamera;
+    private float rerankTimer;
+    private int authoredMaxLights = -1;
+    private float authoredCullingDistance;
+
+    // Reflection into the internal Light2DCullResult (visibleLights / visibleShadows)
+    private PropertyInfo cullResultProperty;
+    private PropertyInfo visibleLightsProperty;
+    private PropertyInfo visibleShadowsProperty;
+
+    public static LightingOptimizer Instance { get; private set; }
+
+    public int RegisteredLightCount => registry.Count;
+    public int EnabledLightCount { get; private set; }
+    public int VisibleLightCount { get; private set; } = -1;  // -1 when cull stats unavailable (release builds)
+    public int VisibleShadowCount { get; private set; } = -1;
+
+    private static readonly System.Comparison<BudgetedLightState> ByScoreDescending = (a, b) => b.score.CompareTo(a.score);
+
+    public static BudgetedLightState Register(Light2D light, bool alwaysOn = false, bool externallyDriven = false)
+    {
+        if (light == null) return null;
+
+        if (lookup.TryGetValue(light, out BudgetedLightState existing))
+            return existing;
+
+        BudgetedLightState state = new BudgetedLightState
+        {
+            light = light,
+            baseIntensity = light.intensity,
+            weight = light.enabled ? 1f : 0f,
+            alwaysOn = alwaysOn || light.lightType == Light2D.LightType.Global,
+            externallyDriven = externallyDriven || drivenLights.Contains(light),
+            wanted = light.enabled,
+            castsShadows = light.shadowsEnabled
+        };
+
+        if (!shadowsAllowed)
+            light.shadowsEnabled = false;
+
+        registry.Add(state);
+        lookup[light] = state;
+        return state;
+    }
+
+    // Marks a light whose intensity another system writes; only budgeted lights are affected,
+    // nothing gets added to the registry
+    public static void SetExternallyDriven(Light2D light, bool driven)
+    {
+        if (light == null) return;
+
+        if (driven)
+            drivenLights.Add(light);
+        else
+            drivenLights.Remove(light);
+
+        if (driven && lookup.TryGetValue(light, out BudgetedLightState state))
+            state.externallyDriven = true;
+    }
+
+    public static void Unregister(Light2D light)
+    {
+        if (light == null || !lookup.TryGetValue(light, out BudgetedLightState state)) return;
+
+        registry.Remove(state);
+        lookup.Remove(light);
+        Instance?.RemoveFromGrid(state);
+
+        // Re-registering reads the intensity back as the base, so undo any fade
+        if (!state.externallyDriven)
+            light.intensity = state.baseIntensity;
+    }
+
+    // Fade weight for externally driven lights (flicker multiplies its intensity by this)
+    public static float GetWeight(Light2D light)
+    {
+        return light != null && lookup.TryGetValue(light, out BudgetedLightState state) ? state.weight : 1f;
+    }
 
     void Start()
     {
-        // Updated method - no sorting needed for performance
-        sceneLights = FindObjectsByType<Light>(FindObjectsSortMode.None);
+        mainCamera = Camera.main;
+
+        player = RoomContext.Player;
 
         // Find player by tag
-        GameObject playerObj = GameObject.FindGameObjectWithTag("Player");
-        if (playerObj != null)
-            player = playerObj.transform;
+        if (player == null)
+        {
+            RoomContext.ReportFallback("Lighting player");
+            GameObject playerObj = GameObject.FindGameObjectWithTag("Player");
+            if (playerObj != null)
+                player = playerObj.transform;
+        }
+
+#if DEVELOPMENT_BUILD || UNITY_EDITOR
+        // Reads an internal URP property; kept out of release builds
+        SetupCullStats();
+#endif
+
+        // Make sure the governor is running; it reports the starting tier from its Start
+        if (adaptiveQuality)
+            _ = QualityGovernor.Instance;
+    }
+
+    // Streamed rooms each have one; the awake room's is the Instance
+    void OnEnable()
+    {
+        Instance = this;
+#if DEVELOPMENT_BUILD || UNITY_EDITOR
+        RenderPipelineManager.endCameraRendering += OnEndCameraRendering;
+#endif
+
+        if (adaptiveQuality)
+        {
+            QualityGovernor.OnQualityChanged += ApplyQuality;
+            if (QualityGovernor.Current != null)
+                ApplyQuality(QualityGovernor.Current);
+        }
+    }
+
+    void OnDisable()
+    {
+        if (Instance == this)
+            Instance = null;
+        RenderPipelineManager.endCameraRendering -= OnEndCameraRendering;
+        QualityGovernor.OnQualityChanged -= ApplyQuality;
+    }
+
+    void ApplyQuality(QualityTier tier)
+    {
+        // Tiers scale the room's own tuning
+        if (authoredMaxLights < 0)
+        {
+            authoredMaxLights = maxLights;
+            authoredCullingDistance = cullingDistance;
+        }
+
+        maxLights = Mathf.Max(1, Mathf.CeilToInt(authoredMaxLights * tier.lightBudgetScale));
+        cullingDistance = authoredCullingDistance * tier.cullingScale;
+        rerankTimer = 0f; // Rerank with the new budget right away
+
+        shadowsAllowed = tier.shadows;
+        foreach (BudgetedLightState state in registry)
+        {
+            if (state.light != null)
+                state.light.shadowsEnabled = shadowsAllowed && state.castsShadows;
+        }
     }
 
     void Update()
     {
-        if (player != null)
-            OptimizeLights();
+        if (mainCamera == null)
+            mainCamera = Camera.main;
+
+        rerankTimer -= Time.unscaledDeltaTime;
+        if (rerankTimer <= 0f && mainCamera != null)
+        {
+            rerankTimer = rerankInterval;
+            RankLights();
+        }
+
+        UpdateFades(Time.unscaledDeltaTime);
+    }
+
+    void RankLights()
+    {
+        // Drop destroyed lights
+        for (int i = registry.Count - 1; i >= 0; i--)
+        {
+            if (registry[i].light == null)
+            {
+                RemoveFromGrid(registry[i]);
+                lookup.Remove(registry[i].light);
+                registry.RemoveAt(i);
+            }
+        }
+
+        Rect view = GetCameraRect();
+        Vector2 focus = player != null ? (Vector2)player.position : view.center;
+
+        candidates.Clear();
+        int budget = maxLights;
+
+        foreach (BudgetedLightState state in registry)
+        {
+            UpdateGridCell(state);
+            state.score = 0f;
+
+            if (state.alwaysOn)
+            {
+                state.wanted = true;
+                budget--;
+            }
+            else
+            {
+                state.wanted = false;
+            }
+        }
+
+        // Only look at cells around the view instead of every light in the room
+        Rect queryRect = new Rect(view.xMin - cullingDistance, view.yMin - cullingDistance,
+                                  view.width + cullingDistance * 2f, view.height + cullingDistance * 2f);
+        Vector2Int minCell = WorldToCell(queryRect.min);
+        Vector2Int maxCell = WorldToCell(queryRect.max);
+
+        for (int x = minCell.x; x <= maxCell.x; x++)
+        {
+            for (int y = minCell.y; y <= maxCell.y; y++)
+            {
+                if (!grid.TryGetValue(new Vector2Int(x, y), out List<BudgetedLightState> cellLights)) continue;
+
+                foreach (BudgetedLightState state in cellLights)
+                {
+                    if (state.alwaysOn) continue;
+
+                    state.score = ScoreLight(state, view, focus);
+                    if (state.score > 0f)
+                        candidates.Add(state);
+                }
+            }
+        }
+
+        candidates.Sort(ByScoreDescending);
+
+        for (int i = 0; i < candidates.Count && i < budget; i++)
+        {
+            candidates[i].wanted = true;
+        }
+    }
+
+    float ScoreLight(BudgetedLightState state, Rect view, Vector2 focus)
+    {
+        Light2D light = state.light;
+        Vector2 position = light.transform.position;
+        float radius = Mathf.Max(light.pointLightOuterRadius, 0.01f);
+
+        float distance = Vector2.Distance(position, focus);
+        if (distance > cullingDistance + radius) return 0f;
+
+        // Screen-space contribution: how much of the light's extent overlaps the view
+        float overlapWidth = Mathf.Min(position.x + radius, view.xMax) - Mathf.Max(position.x - radius, view.xMin);
+        float overlapHeight = Mathf.Min(position.y + radius, view.yMax) - Mathf.Max(position.y - radius, view.yMin);
+        if (overlapWidth <= 0f || overlapHeight <= 0f) return 0f;
+
+        float distanceFactor = 1f / (1f + (distance * distance) / (cullingDistance * cullingDistance));
+        float score = state.baseIntensity * overlapWidth * overlapHeight * distanceFactor;
+
+        // Hysteresis so two similar lights don't swap every rerank
+        if (state.weight > 0f)
+            score *= hysteresisBonus;
+
+        return score;
     }
 
-    void OptimizeLights()
+    void UpdateFades(float deltaTime)
     {
-        foreach (Light light in sceneLights)
+        float step = fadeDuration > 0f ? deltaTime / fadeDuration : 1f;
+        int enabledCount = 0;
+
+        foreach (BudgetedLightState state in registry)
         {
+            Light2D light = state.light;
             if (light == null) continue;
 
-            float distance = Vector3.Distance(player.position, light.transform.position);
-            light.enabled = distance <= cullingDistance;
+            float target = state.wanted ? 1f : 0f;
+            if (state.weight != target)
+            {
+                state.weight = Mathf.MoveTowards(state.weight, target, step);
+
+                if (!state.externallyDriven)
+                    light.intensity = state.baseIntensity * state.weight;
+            }
+
+            bool shouldBeEnabled = state.weight > 0f;
+            if (light.enabled != shouldBeEnabled)
+                light.enabled = shouldBeEnabled;
+
+            if (shouldBeEnabled)
+                enabledCount++;
+        }
+
+        EnabledLightCount = enabledCount;
+    }
+
+    Rect GetCameraRect()
+    {
+        float halfHeight = mainCamera.orthographicSize;
+        float halfWidth = halfHeight * mainCamera.aspect;
+        Vector3 center = mainCamera.transform.position;
+        return new Rect(center.x - halfWidth, center.y - halfHeight, halfWidth * 2f, halfHeight * 2f);
+    }
+
+    Vector2Int WorldToCell(Vector2 position)
+    {
+        return new Vector2Int(Mathf.FloorToInt(position.x / gridCellSize), Mathf.FloorToInt(position.y / gridCellSize));
+    }
+
+    void UpdateGridCell(BudgetedLightState state)
+    {
+        Vector2Int cell = WorldToCell(state.light.transform.position);
+        if (state.inGrid && state.cell == cell) return;
+
+        RemoveFromGrid(state);
+
+        if (!grid.TryGetValue(cell, out List<BudgetedLightState> cellLights))
+        {
+            cellLights = new List<BudgetedLightState>();
+            grid[cell] = cellLights;
+        }
+
+        cellLights.Add(state);
+        state.cell = cell;
+        state.inGrid = true;
+    }
+
+    void RemoveFromGrid(BudgetedLightState state)
+    {
+        if (!state.inGrid) return;
+
+        if (grid.TryGetValue(state.cell, out List<BudgetedLightState> cellLights))
+            cellLights.Remove(state);
+
+        state.inGrid = false;
+    }
+
+    void SetupCullStats()
+    {
+        if (rendererData == null) return;
+
+        cullResultProperty = typeof(Renderer2DData).GetProperty("lightCullResult", BindingFlags.Instance | BindingFlags.NonPublic | BindingFlags.Public);
+        if (cullResultProperty == null)
+        {
+            Debug.LogWarning("[LightingOptimizer] Renderer2DData.lightCullResult not found - cull stats disabled");
+            return;
+        }
+
+        System.Type cullResultType = cullResultProperty.PropertyType;
+        visibleLightsProperty = cullResultType.GetProperty("visibleLights");
+        visibleShadowsProperty = cullResultType.GetProperty("visibleShadows");
+    }
+
+    void OnEndCameraRendering(ScriptableRenderContext context, Camera camera)
+    {
+        if (camera != mainCamera || cullResultProperty == null) return;
+
+        object cullResult = cullResultProperty.GetValue(rendererData);
+        if (cullResult == null) return;
+
+        if (visibleLightsProperty?.GetValue(cullResult) is ICollection lights)
+            VisibleLightCount = lights.Count;
+
+        if (visibleShadowsProperty?.GetValue(cullResult) is IEnumerable shadows)
+        {
+            int count = 0;
+            foreach (object shadow in shadows) count++;
+            VisibleShadowCount = count;
+        }
+    }
+
+    [ContextMenu("Log Light Budget")]
+    public void LogBudget()
+    {
+        Debug.Log($"[LightingOptimizer] Registered: {registry.Count}, Enabled: {EnabledLightCount}/{maxLights}, " +
+                  $"Rendered (cull result): {VisibleLightCount}, Shadow casters: {VisibleShadowCount}");
+    }
+
+    void OnDrawGizmosSelected()
+    {
+        foreach (BudgetedLightState state in registry)
+        {
+            if (state.light == null) continue;
+
+            Gizmos.color = state.wanted ? Color.yellow : Color.gray;
+            Gizmos.DrawWireSphere(state.light.transform.position, state.light.pointLightOuterRadius);
         }
     }
-}
\ No newline at end of file
+}
@@ -2,41 +2,14 @@ using UnityEngine;
 using UnityEngine.UI;
 using UnityEngine.Audio;
 using TMPro;
+using System.Collections;
 
 public class PauseMenuManager : MonoBehaviour
 {
     [Header("Pause Menu Panels")]
-    public GameObject pauseMenuPanel;
-    public GameObject settingsPanel;
-
-    [Header("Main Pause Menu Buttons")]
-    public Button resumeButton;
-    public Button settingsButton;
-    public Button saveGameButton;
-    public Button mainMenuButton;
-
-    [Header("Settings Buttons")]
-    public Button backFromSettingsButton;
-    public Button audioTabButton;
-    public Button videoTabButton;
-
-    [Header("Audio Settings")]
-    public GameObject audioSettingsPanel;
-    public Slider sfxVolumeSlider;
-    public Slider dialogueVolumeSlider;
-    public Slider musicVolumeSlider;
-    public TextMeshProUGUI sfxValueText;
-    public TextMeshProUGUI dialogueValueText;
-    public TextMeshProUGUI musicValueText;
-
-    [Header("Video Settings")]
-    public GameObject videoSettingsPanel;
-    public Slider brightnessSlider;
-    public Slider contrastSlider;
-    public TextMeshProUGUI brightnessValueText;
-    public TextMeshProUGUI contrastValueText;
-    public CanvasGroup brightnessOverlay; // For brightness control
-    public CanvasGroup contrastOverlay;   // Add separate overlay for contrast
+    public string pauseMenuPath = "UI/Menus/PauseMenuPanel"; // Under Resources, loaded on first pause
+    public string settingsPath = "UI/Menus/SettingsPanel";
+    public float releaseAfterSeconds = 30f; // Unloaded once closed this long
 
     [Header("Audio Mixer (Optional)")]
     public AudioMixer audioMixer;
@@ -53,6 +26,11 @@ public class PauseMenuManager : MonoBehaviour
     private bool isInSettings = false;
     private CanvasGroup canvasGroup;
 
+    private LazyMenuPanel<PauseMenuView> pauseMenu;
+    private LazyMenuPanel<SettingsMenuView> settingsMenu;
+    private PauseMenuView pauseView;       // Set once bound
+    private SettingsMenuView settingsView;
+
     // Audio settings
     private float sfxVolume = 1f;
     private float dialogueVolume = 1f;
@@ -66,79 +44,36 @@ public class PauseMenuManager : MonoBehaviour
 
     void Awake()
     {
-        if (Instance == null)
-        {
-            Instance = this;
-        }
-        else
-        {
-            Destroy(gameObject);
-            return;
-        }
-
         canvasGroup = GetComponent<CanvasGroup>();
         if (canvasGroup == null)
         {
             canvasGroup = gameObject.AddComponent<CanvasGroup>();
         }
+
+        pauseMenu = new LazyMenuPanel<PauseMenuView>(pauseMenuPath, transform);
+        settingsMenu = new LazyMenuPanel<SettingsMenuView>(settingsPath, transform);
     }
 
-    void Start()
+    // Every room carries its own menu; the awake room's one is the Instance
+    void OnEnable()
     {
-        SetupUI();
-        LoadSettings();
-        CreateContrastOverlayIfNeeded();
-
-        // Initially hide all panels
-        pauseMenuPanel.SetActive(false);
-        settingsPanel.SetActive(false);
-        audioSettingsPanel.SetActive(true); // Default to audio tab
-        videoSettingsPanel.SetActive(false);
+        Instance = this;
+    }
 
-        // Disable main menu button since title screen isn't ready
-        if (mainMenuButton != null)
-        {
-            mainMenuButton.interactable = false;
-            // Optional: Add tooltip or visual indicator
-            var mainMenuText = mainMenuButton.GetComponentInChildren<TextMeshProUGUI>();
-            if (mainMenuText != null)
-            {
-                mainMenuText.color = Color.gray;
-                mainMenuText.text = "Main Menu (Coming Soon)";
-            }
-        }
+    void OnDisable()
+    {
+        if (Instance == this)
+            Instance = null;
     }
 
-    void CreateContrastOverlayIfNeeded()
+    void Start()
     {
-        // If contrast overlay isn't set, create one dynamically
-        if (contrastOverlay == null && brightnessOverlay != null)
-        {
-            // Create a sibling to the brightness overlay
-            GameObject contrastObj = new GameObject("ContrastOverlay");
-            contrastObj.transform.SetParent(brightnessOverlay.transform.parent);
-
-            // Copy transform properties from brightness overlay
-            RectTransform brightRect = brightnessOverlay.GetComponent<RectTransform>();
-            RectTransform contrastRect = contrastObj.AddComponent<RectTransform>();
-            contrastRect.anchorMin = Vector2.zero;
-            contrastRect.anchorMax = Vector2.one;
-            contrastRect.sizeDelta = Vector2.zero;
-            contrastRect.anchoredPosition = Vector2.zero;
-
-            // Add Image component
-            Image contrastImage = contrastObj.AddComponent<Image>();
-            contrastImage.color = Color.gray;
-            contrastImage.raycastTarget = false;
-
-            // Add CanvasGroup
-            contrastOverlay = contrastObj.AddComponent<CanvasGroup>();
-            contrastOverlay.alpha = 0f;
-            contrastOverlay.interactable = false;
-            contrastOverlay.blocksRaycasts = false;
-
-            Debug.Log("Created ContrastOverlay dynamically");
-        }
+        // Pooled voices route through the same mixer the sliders drive
+        if (audioMixer != null)
+            AudioVoiceManager.Instance?.SetMixer(audioMixer);
+
+        SetupUI();
+        LoadSettings();
     }
 
     void Update()
@@ -162,6 +97,13 @@ public class PauseMenuManager : MonoBehaviour
                 PauseGame();
             }
         }
+
+        // Menus closed for a while go back to disk
+        if (!isPaused)
+        {
+            pauseMenu.ReleaseIfIdle(releaseAfterSeconds);
+            settingsMenu.ReleaseIfIdle(releaseAfterSeconds);
+        }
     }
 
     void SetupUI()
@@ -180,70 +122,124 @@ public class PauseMenuManager : MonoBehaviour
         {
             Debug.LogWarning("Pause button is null in SetupUI!");
         }
+    }
+
+    // Wires a freshly loaded pause panel; runs once per load
+    void BindPauseMenu(PauseMenuView view)
+    {
+        if (view.resumeButton != null)
+            view.resumeButton.onClick.AddListener(ResumeGame);
+
+        if (view.settingsButton != null)
+            view.settingsButton.onClick.AddListener(OpenSettings);
 
-        // Main pause menu buttons
-        if (resumeButton != null)
-            resumeButton.onClick.AddListener(ResumeGame);
+        if (view.saveGameButton != null)
+            view.saveGameButton.onClick.AddListener(OpenSaveMenu);
 
-        if (settingsButton != null)
-            settingsButton.onClick.AddListener(OpenSettings);
+        if (view.mainMenuButton != null)
+        {
+            view.mainMenuButton.onClick.AddListener(GoToMainMenu);
 
-        if (saveGameButton != null)
-            saveGameButton.onClick.AddListener(OpenSaveMenu);
+            // Disable main menu button since title screen isn't ready
+            view.mainMenuButton.interactable = false;
+            var mainMenuText = view.mainMenuButton.GetComponentInChildren<TextMeshProUGUI>();
+            if (mainMenuText != null)
+            {
+                mainMenuText.color = Color.gray;
+                mainMenuText.text = "Main Menu (Coming Soon)";
+            }
+        }
 
-        if (mainMenuButton != null)
-            mainMenuButton.onClick.AddListener(GoToMainMenu);
+        pauseView = view;
+    }
 
+    void BindSettingsMenu(SettingsMenuView view)
+    {
         // Settings navigation
-        if (backFromSettingsButton != null)
-            backFromSettingsButton.onClick.AddListener(BackFromSettings);
+        if (view.backFromSettingsButton != null)
+            view.backFromSettingsButton.onClick.AddListener(BackFromSettings);
 
-        if (audioTabButton != null)
-            audioTabButton.onClick.AddListener(ShowAudioSettings);
+        if (view.audioTabButton != null)
+            view.audioTabButton.onClick.AddListener(ShowAudioSettings);
 
-        if (videoTabButton != null)
-            videoTabButton.onClick.AddListener(ShowVideoSettings);
+        if (view.videoTabButton != null)
+            view.videoTabButton.onClick.AddListener(ShowVideoSettings);
 
-        // Audio sliders
-        if (sfxVolumeSlider != null)
-        {
-            sfxVolumeSlider.onValueChanged.AddListener(SetSFXVolume);
-            sfxVolumeSlider.value = sfxVolume;
-        }
+        // Sliders start at the loaded values without re-applying them
+        BindSlider(view.sfxVolumeSlider, sfxVolume, SetSFXVolume);
+        BindSlider(view.dialogueVolumeSlider, dialogueVolume, SetDialogueVolume);
+        BindSlider(view.musicVolumeSlider, musicVolume, SetMusicVolume);
+        BindSlider(view.brightnessSlider, brightness, SetBrightness);
+        BindSlider(view.contrastSlider, contrast, SetContrast);
 
-        if (dialogueVolumeSlider != null)
-        {
-            dialogueVolumeSlider.onValueChanged.AddListener(SetDialogueVolume);
-            dialogueVolumeSlider.value = dialogueVolume;
-        }
+        settingsView = view;
+        UpdateAllDisplayTexts();
+    }
 
-        if (musicVolumeSlider != null)
-        {
-            musicVolumeSlider.onValueChanged.AddListener(SetMusicVolume);
-            musicVolumeSlider.value = musicVolume;
-        }
+    void BindSlider(Slider slider, float value, UnityEngine.Events.UnityAction<float> onChanged)
+    {
+        if (slider == null) return;
 
-        // Video sliders
-        if (brightnessSlider != null)
+        slider.SetValueWithoutNotify(value);
+        slider.onValueChanged.AddListener(onChanged);
+    }
+
+    IEnumerator ShowPauseMenu()
+    {
+        if (pauseView == null)
         {
-            brightnessSlider.onValueChanged.AddListener(SetBrightness);
-            brightnessSlider.value = brightness;
+            yield return pauseMenu.Load();
+            if (pauseMenu.View == null) yield break;
+            BindPauseMenu(pauseMenu.View);
         }
 
-        if (contrastSlider != null)
+        // Resumed (or moved on to settings/save) while the panel was loading
+        if (!isPaused || isInSettings) yield break;
+
+        pauseMenu.MarkOpen();
+        pauseView.gameObject.SetActive(true);
+    }
+
+    IEnumerator ShowSettingsMenu()
+    {
+        if (settingsView == null)
         {
-            contrastSlider.onValueChanged.AddListener(SetContrast);
-            contrastSlider.value = contrast;
+            yield return settingsMenu.Load();
+            if (settingsMenu.View == null) yield break;
+            BindSettingsMenu(settingsMenu.View);
         }
 
-        UpdateAllDisplayTexts();
+        if (!isPaused || !isInSettings) yield break;
+
+        settingsMenu.MarkOpen();
+        settingsView.gameObject.SetActive(true);
+        ShowAudioSettings(); // Default to audio tab
+    }
+
+    void HidePauseMenu()
+    {
+        if (pauseView != null)
+            pauseView.gameObject.SetActive(false);
+        pauseMenu.MarkClosed();
+    }
+
+    void HideSettingsMenu()
+    {
+        if (settingsView != null)
+            settingsView.gameObject.SetActive(false);
+        settingsMenu.MarkClosed();
     }
 
     public void PauseGame()
     {
+        if (isPaused) return;
+
         isPaused = true;
-        pauseMenuPanel.SetActive(true);
         Time.timeScale = 0f;
+        StartCoroutine(ShowPauseMenu());
+
+        // Static menu - render at a reduced rate until input
+        FramePacingManager.Instance?.RequestIdle("Pause");
 
         // For mobile/2D games, keep cursor visible
         Cursor.visible = true;
@@ -257,10 +253,13 @@ public class PauseMenuManager : MonoBehaviour
     {
         isPaused = false;
         isInSettings = false;
-        pauseMenuPanel.SetActive(false);
-        settingsPanel.SetActive(false);
+        HidePauseMenu();
+        HideSettingsMenu();
         Time.timeScale = 1f;
 
+        if (FramePacingManager.HasInstance)
+            FramePacingManager.Instance.ReleaseIdle("Pause");
+
         // Keep cursor visible for mobile/2D gameplay
         Cursor.visible = true;
 
@@ -274,16 +273,15 @@ public class PauseMenuManager : MonoBehaviour
     public void OpenSettings()
     {
         isInSettings = true;
-        pauseMenuPanel.SetActive(false);
-        settingsPanel.SetActive(true);
-        ShowAudioSettings(); // Default to audio tab
+        HidePauseMenu();
+        StartCoroutine(ShowSettingsMenu());
     }
 
     public void BackFromSettings()
     {
         isInSettings = false;
-        settingsPanel.SetActive(false);
-        pauseMenuPanel.SetActive(true);
+        HideSettingsMenu();
+        StartCoroutine(ShowPauseMenu());
         SaveSettings();
     }
 
@@ -292,7 +290,8 @@ public class PauseMenuManager : MonoBehaviour
         if (saveUIManager != null)
         {
             // Hide pause menu temporarily
-            pauseMenuPanel.SetActive(false);
+            if (pauseView != null)
+                pauseView.gameObject.SetActive(false);
 
             // Open save/load panel
             saveUIManager.OpenSaveLoadPanel();
@@ -318,22 +317,26 @@ public class PauseMenuManager : MonoBehaviour
     // Settings Tab Management
     public void ShowAudioSettings()
     {
-        audioSettingsPanel.SetActive(true);
-        videoSettingsPanel.SetActive(false);
+        if (settingsView == null) return;
+
+        settingsView.audioSettingsPanel.SetActive(true);
+        settingsView.videoSettingsPanel.SetActive(false);
 
         // Update button states
-        SetTabButtonState(audioTabButton, true);
-        SetTabButtonState(videoTabButton, false);
+        SetTabButtonState(settingsView.audioTabButton, true);
+        SetTabButtonState(settingsView.videoTabButton, false);
     }
 
     public void ShowVideoSettings()
     {
-        audioSettingsPanel.SetActive(false);
-        videoSettingsPanel.SetActive(true);
+        if (settingsView == null) return;
+
+        settingsView.audioSettingsPanel.SetActive(false);
+        settingsView.videoSettingsPanel.SetActive(true);
 
         // Update button states
-        SetTabButtonState(audioTabButton, false);
-        SetTabButtonState(videoTabButton, true);
+        SetTabButtonState(settingsView.audioTabButton, false);
+        SetTabButtonState(settingsView.videoTabButton, true);
     }
 
     void SetTabButtonState(Button button, bool isActive)
@@ -358,15 +361,8 @@ public class PauseMenuManager : MonoBehaviour
         }
         else
         {
-            // Fallback: adjust AudioSource volumes directly
-            AudioSource[] audioSources = FindObjectsOfType<AudioSource>();
-            foreach (AudioSource source in audioSources)
-            {
-                if (source.gameObject.CompareTag("SFX"))
-                {
-                    source.volume = volume;
-                }
-            }
+            // Fallback: scale everything routed to the SFX group (pooled voices, ambience loops)
+            AudioVoiceManager.Instance?.SetGroupVolume("SFX", volume);
         }
 
         UpdateSFXValueText();
@@ -381,6 +377,10 @@ public class PauseMenuManager : MonoBehaviour
             float dbValue = volume > 0 ? 20f * Mathf.Log10(volume) : -80f;
             audioMixer.SetFloat("DialogueVolume", dbValue);
         }
+        else
+        {
+            AudioVoiceManager.Instance?.SetGroupVolume("Dialogue", volume);
+        }
 
         UpdateDialogueValueText();
     }
@@ -396,49 +396,17 @@ public class PauseMenuManager : MonoBehaviour
         }
         else
         {
-            // Fallback: adjust music AudioSource volumes
-            AudioSource[] audioSources = FindObjectsOfType<AudioSource>();
-            foreach (AudioSource source in audioSources)
-            {
-                if (source.gameObject.CompareTag("Music"))
-                {
-                    source.volume = volume;
-                }
-            }
+            AudioVoiceManager.Instance?.SetGroupVolume("Music", volume);
         }
 
         UpdateMusicValueText();
     }
 
-    // Video Settings
+    // Video Settings - applied as a post-process color adjustment, not UI overlays
     public void SetBrightness(float value)
     {
         brightness = value;
-
-        if (brightnessOverlay != null)
-        {
-            Image overlayImage = brightnessOverlay.GetComponent<Image>();
-
-            if (brightness < 0.5f)
-            {
-                // Darken screen: black overlay
-                overlayImage.color = Color.black;
-                float alpha = (0.5f - brightness) * 1.6f; // 0 to 0.8 alpha
-                brightnessOverlay.alpha = alpha;
-            }
-            else if (brightness > 0.5f)
-            {
-                // Brighten screen: white overlay
-                overlayImage.color = Color.white;
-                float alpha = (brightness - 0.5f) * 0.8f; // 0 to 0.4 alpha
-                brightnessOverlay.alpha = alpha;
-            }
-            else
-            {
-                // Normal brightness: no overlay
-                brightnessOverlay.alpha = 0f;
-            }
-        }
+        VideoSettingsVolume.Instance?.SetBrightness(brightness);
 
         UpdateBrightnessValueText();
     }
@@ -446,40 +414,7 @@ public class PauseMenuManager : MonoBehaviour
     public void SetContrast(float value)
     {
         contrast = value;
-
-        // Use a separate contrast overlay system
-        if (contrastOverlay != null)
-        {
-            Image overlayImage = contrastOverlay.GetComponent<Image>();
-
-            if (contrast < 0.5f)
-            {
-                // Low contrast: gray overlay reduces color differences
-                overlayImage.color = new Color(0.5f, 0.5f, 0.5f, 1f); // Gray
-                float alpha = (0.5f - contrast) * 0.6f; // 0 to 0.3 alpha for subtle effect
-                contrastOverlay.alpha = alpha;
-            }
-            else if (contrast > 0.5f)
-            {
-                // High contrast: use multiply blend mode effect (simulated with darker edges)
-                // For higher contrast, we darken the overlay slightly to increase contrast
-                overlayImage.color = Color.black;
-                float alpha = (contrast - 0.5f) * 0.2f; // Very subtle darkening at edges
-                contrastOverlay.alpha = alpha;
-
-                // Alternative: Apply a vignette-like effect for high contrast
-                // You could also modify the overlay to have a gradient texture
-            }
-            else
-            {
-                // Normal contrast: no overlay
-                contrastOverlay.alpha = 0f;
-            }
-        }
-        else
-        {
-            Debug.LogWarning("ContrastOverlay not set! Contrast adjustments won't be visible.");
-        }
+        VideoSettingsVolume.Instance?.SetContrast(contrast);
 
         UpdateContrastValueText();
     }
@@ -496,35 +431,35 @@ public class PauseMenuManager : MonoBehaviour
 
     void UpdateSFXValueText()
     {
-        if (sfxValueText != null)
-            sfxValueText.text = Mathf.RoundToInt(sfxVolume * 100) + "%";
+        if (settingsView != null && settingsView.sfxValueText != null)
+            settingsView.sfxValueText.text = Mathf.RoundToInt(sfxVolume * 100) + "%";
     }
 
     void UpdateDialogueValueText()
     {
-        if (dialogueValueText != null)
-            dialogueValueText.text = Mathf.RoundToInt(dialogueVolume * 100) + "%";
+        if (settingsView != null && settingsView.dialogueValueText != null)
+            settingsView.dialogueValueText.text = Mathf.RoundToInt(dialogueVolume * 100) + "%";
     }
 
     void UpdateMusicValueText()
     {
-        if (musicValueText != null)
-            musicValueText.text = Mathf.RoundToInt(musicVolume * 100) + "%";
+        if (settingsView != null && settingsView.musicValueText != null)
+            settingsView.musicValueText.text = Mathf.RoundToInt(musicVolume * 100) + "%";
     }
 
     void UpdateBrightnessValueText()
     {
-        if (brightnessValueText != null)
+        if (settingsView != null && settingsView.brightnessValueText != null)
         {
             int displayValue = Mathf.RoundToInt(brightness * 100);
-            brightnessValueText.text = displayValue + "%";
+            settingsView.brightnessValueText.text = displayValue + "%";
         }
     }
 
     void UpdateContrastValueText()
     {
-        if (contrastValueText != null)
-            contrastValueText.text = Mathf.RoundToInt(contrast * 100) + "%";
+        if (settingsView != null && settingsView.contrastValueText != null)
+            settingsView.contrastValueText.text = Mathf.RoundToInt(contrast * 100) + "%";
     }
 
     // Settings persistence
@@ -546,14 +481,7 @@ public class PauseMenuManager : MonoBehaviour
         brightness = PlayerPrefs.GetFloat("Brightness", 0.5f);
         contrast = PlayerPrefs.GetFloat("Contrast", 0.5f);
 
-        // Apply loaded settings
-        if (sfxVolumeSlider != null) sfxVolumeSlider.value = sfxVolume;
-        if (dialogueVolumeSlider != null) dialogueVolumeSlider.value = dialogueVolume;
-        if (musicVolumeSlider != null) musicVolumeSlider.value = musicVolume;
-        if (brightnessSlider != null) brightnessSlider.value = brightness;
-        if (contrastSlider != null) contrastSlider.value = contrast;
-
-        // Apply settings immediately
+        // Apply settings immediately; sliders pick these up when the panel loads
         SetSFXVolume(sfxVolume);
         SetDialogueVolume(dialogueVolume);
         SetMusicVolume(musicVolume);
@@ -573,7 +501,7 @@ public class PauseMenuManager : MonoBehaviour
         // Show pause menu again when save menu is closed
         if (isPaused)
         {
-            pauseMenuPanel.SetActive(true);
+            StartCoroutine(ShowPauseMenu());
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+using UnityEngine;
+using UnityEngine.UI;
+
+// References inside the PauseMenuPanel prefab, bound by PauseMenuManager once loaded
+public class PauseMenuView : MonoBehaviour
+{
+    [Header("Buttons")]
+    public Button resumeButton;
+    public Button settingsButton;
+    public Button saveGameButton;
+    public Button mainMenuButton;
+}
@@ -0,0 +1,54 @@
+using UnityEngine;
+
+// Base for the services that live for the whole session. Instance creates one on first
+// use so scenes don't need to place it manually, and it outlives the room that created
+// it: rooms come and go around it. Any second copy destroys itself. Subclasses set up in
+// OnSingletonAwake and clean up in OnSingletonDestroy, which only run for the live copy.
+public abstract class PersistentSingleton<T> : MonoBehaviour where T : PersistentSingleton<T>
+{
+    private static T instance;
+    private static bool isQuitting = false;
+
+    public static T Instance
+    {
+        get
+        {
+            // Awake assigns instance; nothing is recreated while the application quits
+            if (instance == null && !isQuitting)
+                new GameObject(typeof(T).Name).AddComponent<T>();
+            return instance;
+        }
+    }
+
+    public static bool HasInstance => instance != null;
+
+    protected void Awake()
+    {
+        if (instance != null && instance != this)
+        {
+            Destroy(gameObject);
+            return;
+        }
+
+        instance = (T)this;
+        DontDestroyOnLoad(gameObject);
+        OnSingletonAwake();
+    }
+
+    protected void OnDestroy()
+    {
+        if (instance != this) return;
+
+        OnSingletonDestroy();
+        instance = null;
+    }
+
+    protected void OnApplicationQuit()
+    {
+        isQuitting = true;
+    }
+
+    protected virtual void OnSingletonAwake() { }
+
+    protected virtual void OnSingletonDestroy() { }
+}
@@ -0,0 +1,114 @@
+using UnityEngine;
+using UnityEngine.SceneManagement;
+using Unity.Profiling;
+using System.Collections;
+using System.Collections.Generic;
+
+// Before/after for the baked collision geometry: per-tile TilemapCollider2D vs merged
+// outlines. Reports static shape count, contacts on dynamic bodies and Physics2D step time.
+public class PhysicsStepProfiler : BakeComparison<BakedCollisionGeometry, PhysicsStepProfiler.StepStats>
+{
+    [Header("Markers")]
+    public string stepMarkerName = "Physics2D.Simulate";
+
+    public struct StepStats
+    {
+        public int staticShapes;
+        public double contactsPerStep; // Contact points on dynamic bodies
+        public double stepMs;          // -1 when the marker isn't available
+        public int steps;
+
+        public override string ToString()
+        {
+            string stepTime = stepMs >= 0 ? $"{stepMs:F3} ms" : "n/a";
+            return $"static shapes {staticShapes}, contacts {contactsPerStep:F1}/step, step {stepTime} ({steps} steps)";
+        }
+    }
+
+    private readonly List<Rigidbody2D> dynamicBodies = new List<Rigidbody2D>();
+    private readonly ContactPoint2D[] contacts = new ContactPoint2D[64];
+    private bool wasAlwaysSimulating;
+
+    protected override string BakeMenu => "Tools/Physics/Bake Collision Geometry (Edges)";
+
+    protected override void BeginComparison()
+    {
+        // Benchmark only, so a scene search is fine here
+        dynamicBodies.Clear();
+        foreach (Rigidbody2D body in FindObjectsByType<Rigidbody2D>(FindObjectsSortMode.None))
+        {
+            if (body.bodyType == RigidbodyType2D.Dynamic)
+                dynamicBodies.Add(body);
+        }
+
+        // Idle-step skipping would leave nothing to measure while the player stands still
+        wasAlwaysSimulating = SimulationTickManager.HasInstance && SimulationTickManager.Instance.alwaysSimulate;
+        if (SimulationTickManager.HasInstance)
+            SimulationTickManager.Instance.alwaysSimulate = true;
+    }
+
+    protected override void EndComparison()
+    {
+        if (SimulationTickManager.HasInstance)
+            SimulationTickManager.Instance.alwaysSimulate = wasAlwaysSimulating;
+    }
+
+    protected override IEnumerator Sample(bool baked, System.Action<StepStats> onDone)
+    {
+        WaitForFixedUpdate afterStep = new WaitForFixedUpdate();
+
+        for (int i = 0; i < warmupSamples; i++)
+            yield return afterStep;
+
+        StepStats stats = new StepStats();
+        foreach (BakedCollisionGeometry geometry in BakedCollisionGeometry.Active)
+            stats.staticShapes += geometry.GetShapeCount(baked);
+
+        double stepTotal = 0;
+        double contactTotal = 0;
+        ProfilerRecorder stepRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Physics, stepMarkerName);
+
+        for (int i = 0; i < sampleCount; i++)
+        {
+            // Runs right after the simulation step
+            yield return afterStep;
+
+            foreach (Rigidbody2D body in dynamicBodies)
+            {
+                if (body != null)
+                    contactTotal += body.GetContacts(contacts);
+            }
+
+            if (stepRecorder.Valid)
+                stepTotal += stepRecorder.LastValue;
+
+            stats.steps++;
+        }
+
+        int steps = Mathf.Max(1, stats.steps);
+        stats.contactsPerStep = contactTotal / steps;
+        stats.stepMs = stepRecorder.Valid ? stepTotal / steps * 1e-6 : -1; // Nanoseconds
+        stepRecorder.Dispose();
+
+        onDone(stats);
+    }
+
+    protected override string BuildReport()
+    {
+        int tiles = 0;
+        int paths = 0;
+        int vertices = 0;
+
+        foreach (BakedCollisionGeometry geometry in BakedCollisionGeometry.Active)
+        {
+            tiles += geometry.sourceTileCount;
+            paths += geometry.bakedPathCount;
+            vertices += geometry.bakedVertexCount;
+        }
+
+        return $"[PhysicsStepProfiler] {SceneManager.GetActiveScene().name}: {tiles} collision tiles -> {paths} paths ({vertices} verts), " +
+               $"{dynamicBodies.Count} dynamic bodies\n" +
+               $"  Before (TilemapCollider2D): {Before}\n" +
+               $"  After  (baked outlines):    {After}";
+    }
+}
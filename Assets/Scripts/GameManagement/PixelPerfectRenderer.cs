@@ -0,0 +1,208 @@
+using UnityEngine;
+using UnityEngine.Rendering;
+using UnityEngine.UI;
+
+public enum PixelUpscaleMode
+{
+    Integer,       // Fixed reference height at the largest whole-number scale, letterboxed
+    SharpBilinear  // Fixed reference height, point prescale then bilinear to fill the screen
+}
+
+// Renders the world (sprites, tiles, 2D lights and shadows) into a low-res target where
+// one texel is one art pixel, then upscales to the screen. Screen Space Overlay canvases
+// still draw at native resolution on top.
+[RequireComponent(typeof(Camera))]
+public class PixelPerfectRenderer : MonoBehaviour
+{
+    [Header("Art")]
+    public int assetsPixelsPerUnit = 16; // Tileset.png
+    public int referenceHeight = 160;    // Art pixels visible vertically (orthographic size 5)
+
+    [Header("Upscale")]
+    public PixelUpscaleMode upscaleMode = PixelUpscaleMode.Integer;
+    public int outputSortingOrder = -1000; // Below every gameplay canvas
+
+    private Camera worldCamera;
+    private Camera outputCamera;
+    private Canvas outputCanvas;
+    private RawImage outputImage;
+    private RenderTexture lowResTarget;
+    private RenderTexture prescaleTarget;
+    private CommandBuffer prescaleCommands;
+    private Vector2Int screenSize;
+    private float originalOrthographicSize;
+
+    public int Scale { get; private set; } = 1;
+    public Vector2Int TargetSize => lowResTarget != null ? new Vector2Int(lowResTarget.width, lowResTarget.height) : Vector2Int.zero;
+    public float UnitsPerPixel => 1f / assetsPixelsPerUnit;
+
+    void Awake()
+    {
+        worldCamera = GetComponent<Camera>();
+        originalOrthographicSize = worldCamera.orthographicSize;
+    }
+
+    void OnEnable()
+    {
+        CreateOutput();
+        Rebuild();
+        RenderPipelineManager.endCameraRendering += OnEndCameraRendering;
+    }
+
+    void OnDisable()
+    {
+        RenderPipelineManager.endCameraRendering -= OnEndCameraRendering;
+
+        if (worldCamera != null)
+        {
+            worldCamera.targetTexture = null;
+            worldCamera.orthographicSize = originalOrthographicSize;
+        }
+
+        if (outputCanvas != null)
+            Destroy(outputCanvas.gameObject);
+        if (outputCamera != null)
+            Destroy(outputCamera.gameObject);
+
+        ReleaseTargets();
+    }
+
+    void LateUpdate()
+    {
+        if (Screen.width != screenSize.x || Screen.height != screenSize.y)
+            Rebuild();
+    }
+
+    // World position snapped to the art pixel grid (CameraFollow uses this to avoid shimmer)
+    public Vector3 SnapToPixel(Vector3 position)
+    {
+        float unitsPerPixel = UnitsPerPixel;
+        position.x = Mathf.Round(position.x / unitsPerPixel) * unitsPerPixel;
+        position.y = Mathf.Round(position.y / unitsPerPixel) * unitsPerPixel;
+        return position;
+    }
+
+    // Screen position of a world point, through the low-res target and its upscale
+    public Vector2 WorldToScreenPoint(Vector3 position)
+    {
+        Vector3 viewport = worldCamera.WorldToViewportPoint(position);
+
+        if (upscaleMode == PixelUpscaleMode.Integer)
+        {
+            // The scaled target is centered with black borders around it
+            Vector2 outputSize = (Vector2)TargetSize * Scale;
+            return new Vector2(screenSize.x * 0.5f + (viewport.x - 0.5f) * outputSize.x,
+                               screenSize.y * 0.5f + (viewport.y - 0.5f) * outputSize.y);
+        }
+
+        return new Vector2(viewport.x * screenSize.x, viewport.y * screenSize.y);
+    }
+
+    void CreateOutput()
+    {
+        // Clears the back buffer; the upscaled image is drawn by the overlay canvas below
+        GameObject cameraObj = new GameObject("PixelOutputCamera");
+        cameraObj.transform.SetParent(transform, false);
+        outputCamera = cameraObj.AddComponent<Camera>();
+        outputCamera.cullingMask = 0;
+        outputCamera.clearFlags = CameraClearFlags.SolidColor;
+        outputCamera.backgroundColor = Color.black;
+        outputCamera.depth = worldCamera.depth + 1;
+        outputCamera.orthographic = true;
+
+        GameObject canvasObj = new GameObject("PixelOutputCanvas");
+        outputCanvas = canvasObj.AddComponent<Canvas>();
+        outputCanvas.renderMode = RenderMode.ScreenSpaceOverlay;
+        outputCanvas.sortingOrder = outputSortingOrder;
+        outputCanvas.pixelPerfect = false;
+
+        GameObject imageObj = new GameObject("PixelOutput");
+        imageObj.transform.SetParent(canvasObj.transform, false);
+        outputImage = imageObj.AddComponent<RawImage>();
+        outputImage.raycastTarget = false;
+
+        RectTransform rect = outputImage.rectTransform;
+        rect.anchorMin = rect.anchorMax = new Vector2(0.5f, 0.5f);
+        rect.pivot = new Vector2(0.5f, 0.5f);
+        rect.anchoredPosition = Vector2.zero;
+    }
+
+    void Rebuild()
+    {
+        screenSize = new Vector2Int(Screen.width, Screen.height);
+        ReleaseTargets();
+
+        int width;
+        int height;
+
+        // Same view on every device: the reference height, widened to the screen aspect
+        Scale = Mathf.Max(1, screenSize.y / referenceHeight);
+        height = referenceHeight;
+        width = Mathf.CeilToInt(referenceHeight * (float)screenSize.x / screenSize.y);
+
+        lowResTarget = new RenderTexture(width, height, 0, RenderTextureFormat.Default);
+        lowResTarget.name = "PixelPerfectTarget";
+        lowResTarget.filterMode = FilterMode.Point;
+        lowResTarget.Create();
+
+        worldCamera.targetTexture = lowResTarget;
+        worldCamera.orthographicSize = height * 0.5f / assetsPixelsPerUnit;
+
+        RectTransform rect = outputImage.rectTransform;
+        float canvasScale = outputCanvas.scaleFactor > 0f ? outputCanvas.scaleFactor : 1f;
+
+        if (upscaleMode == PixelUpscaleMode.Integer)
+        {
+            // Exactly Scale screen pixels per texel; the output camera's clear letterboxes the rest
+            outputImage.texture = lowResTarget;
+            rect.sizeDelta = new Vector2(width * Scale, height * Scale) / canvasScale;
+        }
+        else
+        {
+            // Point prescale keeps texel edges sharp, bilinear only blends the last fraction
+            prescaleTarget = new RenderTexture(width * Scale, height * Scale, 0, RenderTextureFormat.Default);
+            prescaleTarget.name = "PixelPerfectPrescale";
+            prescaleTarget.filterMode = FilterMode.Bilinear;
+            prescaleTarget.Create();
+
+            prescaleCommands = new CommandBuffer { name = "Pixel Prescale" };
+            prescaleCommands.Blit(lowResTarget, prescaleTarget);
+
+            outputImage.texture = prescaleTarget;
+            rect.sizeDelta = new Vector2(screenSize.x, screenSize.y) / canvasScale;
+        }
+
+        Debug.Log($"[PixelPerfectRenderer] {screenSize.x}x{screenSize.y} -> {width}x{height} target, x{Scale} {upscaleMode}");
+    }
+
+    void OnEndCameraRendering(ScriptableRenderContext context, Camera camera)
+    {
+        if (camera != worldCamera || prescaleCommands == null) return;
+
+        context.ExecuteCommandBuffer(prescaleCommands);
+        context.Submit();
+    }
+
+    void ReleaseTargets()
+    {
+        if (worldCamera != null && worldCamera.targetTexture == lowResTarget)
+            worldCamera.targetTexture = null;
+
+        if (lowResTarget != null)
+        {
+            lowResTarget.Release();
+            Destroy(lowResTarget);
+            lowResTarget = null;
+        }
+
+        if (prescaleTarget != null)
+        {
+            prescaleTarget.Release();
+            Destroy(prescaleTarget);
+            prescaleTarget = null;
+        }
+
+        prescaleCommands?.Release();
+        prescaleCommands = null;
+    }
+}
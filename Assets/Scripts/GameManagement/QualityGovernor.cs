@@ -0,0 +1,188 @@
+using UnityEngine;
+
+[System.Serializable]
+public class QualityTier
+{
+    public string tierName;
+    public float lightBudgetScale;     // Of the scene's LightingOptimizer maxLights, rounded up
+    public float cullingScale;         // Of the scene's LightingOptimizer cullingDistance
+    public bool shadows;               // Light2D shadows on budgeted lights
+    public float flickerRate;          // Flicker updates per second, 0 = every frame
+    public bool postProcessing;        // Off keeps only the brightness/contrast grading
+
+    public QualityTier(string tierName, float lightBudgetScale, float cullingScale, bool shadows, float flickerRate, bool postProcessing)
+    {
+        this.tierName = tierName;
+        this.lightBudgetScale = lightBudgetScale;
+        this.cullingScale = cullingScale;
+        this.shadows = shadows;
+        this.flickerRate = flickerRate;
+        this.postProcessing = postProcessing;
+    }
+}
+
+// Watches a rolling frame-time percentile and steps through quality tiers (0 = best).
+// Tiers scale what each scene is tuned for rather than replacing it, so the best tier
+// is the scene as authored.
+// Drops quickly when frames run long, climbs back slowly, and waits out a cooldown
+// after every change so thermal throttling doesn't make it oscillate. Systems listen
+// to OnQualityChanged and apply the fields they own.
+public class QualityGovernor : PersistentSingleton<QualityGovernor>
+{
+    [Header("Tiers (best first)")]
+    public QualityTier[] tiers =
+    {
+        new QualityTier("High", 1f, 1f, true, 0f, true),
+        new QualityTier("Medium", 0.75f, 0.8f, true, 30f, true),
+        new QualityTier("Low", 0.5f, 0.65f, false, 15f, true),
+        new QualityTier("Minimum", 0.25f, 0.5f, false, 10f, false)
+    };
+
+    [Header("Telemetry")]
+    public int windowFrames = 120;
+    [Range(0.5f, 0.99f)] public float percentile = 0.9f;
+    public float evaluateInterval = 1f;
+
+    [Header("Hysteresis")]
+    public float downgradeThreshold = 1.15f; // Percentile over target by this factor
+    public float upgradeThreshold = 0.75f;   // Percentile under target by this factor
+    public int downgradeEvaluations = 2;     // Consecutive bad windows before dropping
+    public int upgradeEvaluations = 10;      // Consecutive good windows before climbing
+    public float changeCooldown = 5f;
+
+    [Header("Debug")]
+    public bool logChanges = true;
+
+    public static event System.Action<QualityTier> OnQualityChanged;
+
+    private float[] frameTimes;
+    private float[] sortScratch;
+    private int frameIndex;
+    private int frameCount;
+    private float evaluateTimer;
+    private float cooldownTimer;
+    private int badEvaluations;
+    private int goodEvaluations;
+    private int tierIndex;
+
+    private const string TierKey = "QualityTier";
+    private const string TierFrameRateKey = "QualityTierFrameRate"; // Target the saved tier was judged against
+
+    // Null until the governor exists; listeners keep their inspector settings until then
+    public static QualityTier Current => HasInstance ? Instance.tiers[Instance.tierIndex] : null;
+
+    public int TierIndex => tierIndex;
+    public float LastPercentileMs { get; private set; }
+
+    protected override void OnSingletonAwake()
+    {
+        frameTimes = new float[windowFrames];
+        sortScratch = new float[windowFrames];
+
+        // Devices that throttled last session start where they ended up, unless that tier
+        // was learned against a different frame rate target
+        if (PlayerPrefs.GetInt(TierFrameRateKey, 0) == Mathf.RoundToInt(GetTargetFrameRate()))
+            tierIndex = Mathf.Clamp(PlayerPrefs.GetInt(TierKey, 0), 0, tiers.Length - 1);
+    }
+
+    void Start()
+    {
+        OnQualityChanged?.Invoke(tiers[tierIndex]);
+    }
+
+    void Update()
+    {
+        // Idle pacing lowers the frame rate on purpose; don't read that as load
+        if (FramePacingManager.HasInstance && FramePacingManager.Instance.IsIdle)
+        {
+            frameCount = 0;
+            return;
+        }
+
+        frameTimes[frameIndex] = Time.unscaledDeltaTime;
+        frameIndex = (frameIndex + 1) % frameTimes.Length;
+        frameCount = Mathf.Min(frameCount + 1, frameTimes.Length);
+
+        if (cooldownTimer > 0f)
+            cooldownTimer -= Time.unscaledDeltaTime;
+
+        evaluateTimer -= Time.unscaledDeltaTime;
+        if (evaluateTimer > 0f || frameCount < frameTimes.Length) return;
+
+        evaluateTimer = evaluateInterval;
+        Evaluate();
+    }
+
+    void Evaluate()
+    {
+        System.Array.Copy(frameTimes, sortScratch, frameCount);
+        System.Array.Sort(sortScratch, 0, frameCount);
+
+        float value = sortScratch[Mathf.Clamp(Mathf.CeilToInt(frameCount * percentile) - 1, 0, frameCount - 1)];
+        LastPercentileMs = value * 1000f;
+
+        float target = 1f / GetTargetFrameRate();
+
+        if (value > target * downgradeThreshold)
+        {
+            badEvaluations++;
+            goodEvaluations = 0;
+        }
+        else if (value < target * upgradeThreshold)
+        {
+            goodEvaluations++;
+            badEvaluations = 0;
+        }
+        else
+        {
+            badEvaluations = 0;
+            goodEvaluations = 0;
+        }
+
+        if (cooldownTimer > 0f) return;
+
+        if (badEvaluations >= downgradeEvaluations && tierIndex < tiers.Length - 1)
+            SetTier(tierIndex + 1);
+        else if (goodEvaluations >= upgradeEvaluations && tierIndex > 0)
+            SetTier(tierIndex - 1);
+    }
+
+    float GetTargetFrameRate()
+    {
+        if (FramePacingManager.HasInstance)
+            return FramePacingManager.Instance.ActiveFrameRate;
+
+        return FramePacingManager.EffectiveFrameRate(Application.targetFrameRate);
+    }
+
+    public void SetTier(int index)
+    {
+        index = Mathf.Clamp(index, 0, tiers.Length - 1);
+        if (index == tierIndex) return;
+
+        if (logChanges)
+            Debug.Log($"[QualityGovernor] {tiers[tierIndex].tierName} -> {tiers[index].tierName} (p{Mathf.RoundToInt(percentile * 100)} {LastPercentileMs:F1} ms)");
+
+        tierIndex = index;
+        badEvaluations = 0;
+        goodEvaluations = 0;
+        cooldownTimer = changeCooldown;
+        frameCount = 0; // Judge the new tier on its own frames
+
+        PlayerPrefs.SetInt(TierKey, tierIndex);
+        PlayerPrefs.SetInt(TierFrameRateKey, Mathf.RoundToInt(GetTargetFrameRate()));
+        OnQualityChanged?.Invoke(tiers[tierIndex]);
+    }
+
+    [ContextMenu("Step Down")]
+    void StepDown()
+    {
+        SetTier(tierIndex + 1);
+    }
+
+    [ContextMenu("Step Up")]
+    void StepUp()
+    {
+        SetTier(tierIndex - 1);
+    }
+}
@@ -0,0 +1,87 @@
+using UnityEngine;
+using Unity.Profiling;
+
+// Averages the render counters over a run of frames for the before/after benchmarks.
+// Counters work in development and release players; render thread time needs
+// Frame Timing Stats enabled in Player Settings and reads n/a otherwise.
+public class RenderStatsRecorder : System.IDisposable
+{
+    public struct Result
+    {
+        public double batches;
+        public double drawCalls;
+        public double setPassCalls;
+        public double renderThreadMs; // -1 when frame timing is unavailable
+        public double markerMs;       // -1 when no marker was given or it doesn't exist
+        public int frames;
+
+        public override string ToString()
+        {
+            string renderThread = renderThreadMs >= 0 ? $"{renderThreadMs:F2} ms" : "n/a";
+            string marker = markerMs >= 0 ? $", marker {markerMs:F3} ms" : "";
+            return $"batches {batches:F1}, draw calls {drawCalls:F1}, SetPass {setPassCalls:F1}, " +
+                   $"render thread {renderThread}{marker} ({frames} frames)";
+        }
+    }
+
+    private ProfilerRecorder batchesRecorder;
+    private ProfilerRecorder drawCallsRecorder;
+    private ProfilerRecorder setPassRecorder;
+    private ProfilerRecorder markerRecorder;
+    private readonly FrameTiming[] timings = new FrameTiming[1];
+
+    private Result totals;
+    private int renderThreadFrames;
+
+    public RenderStatsRecorder(string markerName = null)
+    {
+        batchesRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Render, "Batches Count");
+        drawCallsRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Render, "Draw Calls Count");
+        setPassRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Render, "SetPass Calls Count");
+
+        if (!string.IsNullOrEmpty(markerName))
+            markerRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Render, markerName);
+    }
+
+    // Call once per frame after rendering (WaitForEndOfFrame)
+    public void SampleFrame()
+    {
+        totals.batches += batchesRecorder.LastValue;
+        totals.drawCalls += drawCallsRecorder.LastValue;
+        totals.setPassCalls += setPassRecorder.LastValue;
+
+        if (markerRecorder.Valid)
+            totals.markerMs += markerRecorder.LastValue * 1e-6; // Marker values are in nanoseconds
+
+        FrameTimingManager.CaptureFrameTimings();
+        if (FrameTimingManager.GetLatestTimings(1, timings) > 0 && timings[0].cpuRenderThreadFrameTime > 0)
+        {
+            totals.renderThreadMs += timings[0].cpuRenderThreadFrameTime;
+            renderThreadFrames++;
+        }
+
+        totals.frames++;
+    }
+
+    public Result GetResult()
+    {
+        Result result = totals;
+        int frames = Mathf.Max(1, totals.frames);
+
+        result.batches /= frames;
+        result.drawCalls /= frames;
+        result.setPassCalls /= frames;
+        result.markerMs = markerRecorder.Valid ? totals.markerMs / frames : -1;
+        result.renderThreadMs = renderThreadFrames > 0 ? totals.renderThreadMs / renderThreadFrames : -1;
+
+        return result;
+    }
+
+    public void Dispose()
+    {
+        batchesRecorder.Dispose();
+        drawCallsRecorder.Dispose();
+        setPassRecorder.Dispose();
+        markerRecorder.Dispose();
+    }
+}
@@ -0,0 +1,236 @@
+using UnityEngine;
+using System.Collections.Generic;
+using System.IO;
+
+// Loads the per-room asset bundles built by RoomBundleBuilder (StreamingAssets/RoomBundles).
+// Each room is a scene bundle plus the content bundles it depends on (its own, and the
+// shared one); bundles load asynchronously and are reference counted, so content used by
+// two streamed rooms stays resident until both have been released.
+public class RoomBundleManager : PersistentSingleton<RoomBundleManager>
+{
+    public const string BundleFolder = "RoomBundles";   // Under StreamingAssets; also the manifest bundle's name
+    public const string SceneBundlePrefix = "rooms/";   // rooms/<room name, lower case>
+    public const string ContentBundlePrefix = "content/";
+    public const string SharedBundleName = "content/shared";
+    public const string UseBundlesInEditorPref = "RoomBundles.UseBundlesInEditor"; // EditorPrefs, Tools/Rooms menu
+
+    [Header("Debug")]
+    public bool logBundles = true;
+
+    class LoadedBundle
+    {
+        public string name;
+        public int refCount;
+        public AssetBundleCreateRequest request;
+        public AssetBundle bundle;
+        public float loadStart;
+        public float loadMs = -1f;
+    }
+
+    private AssetBundleManifest manifest;
+    private readonly HashSet<string> sceneBundles = new HashSet<string>();
+    private readonly Dictionary<string, LoadedBundle> bundles = new Dictionary<string, LoadedBundle>();
+    private readonly List<LoadedBundle> pending = new List<LoadedBundle>();
+
+    protected override void OnSingletonAwake()
+    {
+#if UNITY_EDITOR
+        // Off: the editor loads rooms straight from the project
+        if (!UnityEditor.EditorPrefs.GetBool(UseBundlesInEditorPref, false)) return;
+#endif
+        LoadManifest();
+    }
+
+    protected override void OnSingletonDestroy()
+    {
+        foreach (LoadedBundle entry in bundles.Values)
+        {
+            if (entry.bundle != null)
+                entry.bundle.Unload(true);
+        }
+        bundles.Clear();
+    }
+
+    // Only the small manifest bundle is read up front; room bundles load on demand
+    void LoadManifest()
+    {
+        string manifestPath = GetBundlePath(BundleFolder);
+        if (!File.Exists(manifestPath) && !manifestPath.Contains("://"))
+        {
+            if (logBundles)
+                Debug.Log("[RoomBundleManager] No room bundles in StreamingAssets - rooms load from the player build");
+            return;
+        }
+
+        AssetBundle manifestBundle = AssetBundle.LoadFromFile(manifestPath);
+        if (manifestBundle == null)
+        {
+            Debug.LogWarning($"[RoomBundleManager] Failed to open {manifestPath}");
+            return;
+        }
+
+        manifest = manifestBundle.LoadAsset<AssetBundleManifest>("AssetBundleManifest");
+        manifestBundle.Unload(false);
+
+        if (manifest == null) return;
+
+        foreach (string bundleName in manifest.GetAllAssetBundles())
+        {
+            if (bundleName.StartsWith(SceneBundlePrefix))
+                sceneBundles.Add(bundleName);
+        }
+
+        if (logBundles)
+            Debug.Log($"[RoomBundleManager] {sceneBundles.Count} room bundles available");
+    }
+
+    static string GetBundlePath(string bundleName)
+    {
+        return Path.Combine(Application.streamingAssetsPath, BundleFolder, bundleName);
+    }
+
+    public static string GetSceneBundleName(string roomName)
+    {
+        return SceneBundlePrefix + roomName.ToLowerInvariant();
+    }
+
+    // The room ships as a bundle rather than in the player build
+    public bool HasRoom(string roomName)
+    {
+        return !string.IsNullOrEmpty(roomName) && sceneBundles.Contains(GetSceneBundleName(roomName));
+    }
+
+    // Starts loading the room's scene bundle and everything it depends on. Every
+    // Acquire must be matched by a Release once the scene has been unloaded.
+    // immediate blocks until loaded, for the synchronous SceneManager.LoadScene paths.
+    public void Acquire(string roomName, bool immediate = false)
+    {
+        if (!HasRoom(roomName)) return;
+
+        string sceneBundle = GetSceneBundleName(roomName);
+        foreach (string dependency in manifest.GetAllDependencies(sceneBundle))
+            AcquireBundle(dependency, immediate);
+        AcquireBundle(sceneBundle, immediate);
+    }
+
+    public void Release(string roomName)
+    {
+        if (!HasRoom(roomName)) return;
+
+        string sceneBundle = GetSceneBundleName(roomName);
+        ReleaseBundle(sceneBundle);
+        foreach (string dependency in manifest.GetAllDependencies(sceneBundle))
+            ReleaseBundle(dependency);
+    }
+
+    // The scene and all its content are in memory, so LoadSceneAsync can find it by name
+    public bool IsReady(string roomName)
+    {
+        if (!HasRoom(roomName)) return true;
+
+        string sceneBundle = GetSceneBundleName(roomName);
+        if (!IsLoaded(sceneBundle)) return false;
+
+        foreach (string dependency in manifest.GetAllDependencies(sceneBundle))
+        {
+            if (!IsLoaded(dependency))
+                return false;
+        }
+        return true;
+    }
+
+    // Finished loading; a bundle that failed counts too, the scene load reports it
+    bool IsLoaded(string bundleName)
+    {
+        return bundles.TryGetValue(bundleName, out LoadedBundle entry) && entry.request == null;
+    }
+
+    void AcquireBundle(string bundleName, bool immediate)
+    {
+        if (!bundles.TryGetValue(bundleName, out LoadedBundle entry))
+        {
+            entry = new LoadedBundle { name = bundleName };
+            bundles.Add(bundleName, entry);
+        }
+
+        entry.refCount++;
+        if (entry.bundle == null && entry.request == null)
+        {
+            entry.loadStart = Time.realtimeSinceStartup;
+            entry.request = AssetBundle.LoadFromFileAsync(GetBundlePath(bundleName));
+            pending.Add(entry);
+        }
+
+        // Reading assetBundle before the request is done finishes it on the spot
+        if (immediate && entry.request != null)
+        {
+            pending.Remove(entry);
+            FinishLoad(entry);
+        }
+    }
+
+    void ReleaseBundle(string bundleName)
+    {
+        if (!bundles.TryGetValue(bundleName, out LoadedBundle entry)) return;
+
+        entry.refCount--;
+        if (entry.refCount > 0) return;
+
+        // Still loading: Update unloads it once it arrives
+        if (entry.request != null) return;
+
+        Unload(entry);
+    }
+
+    void Unload(LoadedBundle entry)
+    {
+        // The scene using it is gone, so its objects can go with it
+        if (entry.bundle != null)
+            entry.bundle.Unload(true);
+
+        bundles.Remove(entry.name);
+
+        if (logBundles)
+            Debug.Log($"[RoomBundleManager] Unloaded {entry.name}");
+    }
+
+    void Update()
+    {
+        for (int i = pending.Count - 1; i >= 0; i--)
+        {
+            LoadedBundle entry = pending[i];
+            if (!entry.request.isDone) continue;
+
+            pending.RemoveAt(i);
+            FinishLoad(entry);
+
+            if (entry.refCount <= 0)
+                Unload(entry);
+        }
+    }
+
+    void FinishLoad(LoadedBundle entry)
+    {
+        entry.bundle = entry.request.assetBundle;
+        entry.request = null;
+        entry.loadMs = (Time.realtimeSinceStartup - entry.loadStart) * 1000f;
+
+        if (entry.bundle == null)
+            Debug.LogError($"[RoomBundleManager] Failed to load {entry.name}");
+        else if (logBundles)
+            Debug.Log($"[RoomBundleManager] Loaded {entry.name} in {entry.loadMs:F0} ms");
+    }
+
+    [ContextMenu("Log Bundles")]
+    void LogBundles()
+    {
+        System.Text.StringBuilder report = new System.Text.StringBuilder();
+        foreach (LoadedBundle entry in bundles.Values)
+        {
+            string state = entry.request != null ? "loading" : entry.bundle != null ? $"{entry.loadMs:F0} ms" : "failed";
+            report.Append($"\n  {entry.name}: {entry.refCount} refs, {state}");
+        }
+
+        Debug.Log($"[RoomBundleManager] {bundles.Count} bundles resident{report}");
+    }
+}
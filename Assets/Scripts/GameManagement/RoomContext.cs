@@ -0,0 +1,119 @@
+using UnityEngine;
+using UnityEngine.UI;
+using UnityEngine.Rendering.Universal;
+using UnityEngine.Tilemaps;
+using TMPro;
+
+// Baked scene references for the current room so Start methods don't have to search
+// the scene. Filled in by Tools/Rooms/Bake Room Metadata; systems fall back to their
+// old lookups when a room hasn't been baked.
+[DefaultExecutionOrder(-900)]
+public class RoomContext : MonoBehaviour
+{
+    [Header("Baked Data")]
+    public RoomMetadata metadata;
+
+    [Header("Player")]
+    public Transform player;
+    public JoystickPlayerController playerController;
+
+    [Header("UI")]
+    public GameObject joystickUI;
+    public VirtualJoystick joystick;
+
+    [Header("Room Canvases")] // Persistent managers switch to these when the room wakes
+    public InventoryUI inventoryUI;
+    public GameObject dialoguePanel;
+    public Image dialogueBoxImage;
+    public TextMeshProUGUI dialogueText;
+    public TextMeshProUGUI speakerNameText;
+
+    [Header("Scene Objects")]
+    public Tilemap[] boundaryTilemaps = new Tilemap[0];
+    public Light2D[] lights = new Light2D[0];
+    public ItemPickup[] pickups = new ItemPickup[0];
+    public PuzzleInteractable[] puzzles = new PuzzleInteractable[0];
+
+    [Header("Simulation")]
+    public bool skipIdlePhysics = false; // Only when every dynamic body and trigger in the room is registered
+
+    [Header("Debug")]
+    public bool logActivationTime = true;
+
+    public static RoomContext Current { get; private set; }
+
+    private float activationStart;
+    private bool activationLogged = false;
+    private static int fallbackCount = 0;
+
+    void Awake()
+    {
+        // Streamed in as a neighbour: the room sleeps until the player walks in
+        if (RoomStreamingManager.SleepIfPreloading(this)) return;
+
+        OnWake();
+    }
+
+    void Start()
+    {
+        RoomStreamingManager.Instance?.OnRoomStarted(this);
+    }
+
+    // Also called by RoomStreamingManager each time the player enters a streamed room
+    public void OnWake()
+    {
+        Current = this;
+        activationStart = Time.realtimeSinceStartup;
+        activationLogged = false;
+        fallbackCount = 0;
+
+        if (skipIdlePhysics || SimulationTickManager.HasInstance)
+            SimulationTickManager.Instance.skipIdleSteps = skipIdlePhysics;
+
+        BindPersistentSystems();
+    }
+
+    // Managers that outlive their room still point at the room that created them;
+    // the first room's objects are asleep or unloaded by the time this one wakes
+    void BindPersistentSystems()
+    {
+        if (SaveSystem.Instance != null && player != null)
+            SaveSystem.Instance.player = player;
+
+        if (InventoryManager.Instance != null && inventoryUI != null)
+            InventoryManager.Instance.inventoryUI = inventoryUI;
+
+        if (DialogueSystemV2.Instance != null)
+            DialogueSystemV2.Instance.BindRoom(this);
+    }
+
+    void OnDestroy()
+    {
+        if (Current == this)
+            Current = null;
+    }
+
+    // Awake..first LateUpdate covers every Start in the room
+    void LateUpdate()
+    {
+        if (activationLogged) return;
+
+        activationLogged = true;
+        if (logActivationTime)
+        {
+            float milliseconds = (Time.realtimeSinceStartup - activationStart) * 1000f;
+            Debug.Log($"[RoomContext] {gameObject.scene.name} activated in {milliseconds:F1} ms " +
+                      $"({(metadata != null ? "baked" : "no metadata")}, {fallbackCount} scene searches)");
+        }
+    }
+
+    public static Transform Player => Current != null ? Current.player : null;
+
+    // Systems call this when they had to search the scene anyway, so unbaked rooms show up in the log
+    public static void ReportFallback(string what)
+    {
+        fallbackCount++;
+        if (Current != null)
+            Debug.LogWarning($"[RoomContext] {what} not baked for {Current.gameObject.scene.name}, searching scene");
+    }
+}
@@ -0,0 +1,23 @@
+using UnityEngine;
+
+// Trigger at a doorway. The room behind it is normally already streamed in, so
+// walking through swaps rooms in the same frame with no loading screen.
+[RequireComponent(typeof(Collider2D))]
+public class RoomDoor : MonoBehaviour
+{
+    [Header("Destination")]
+    public string targetRoom;            // Scene name, must be in the RoomGraph
+    public string targetSpawnId = "Default";
+
+    void Reset()
+    {
+        GetComponent<Collider2D>().isTrigger = true;
+    }
+
+    void OnTriggerEnter2D(Collider2D other)
+    {
+        if (other.GetComponentInParent<JoystickPlayerController>() == null) return;
+
+        RoomStreamingManager.Instance?.EnterRoom(targetRoom, targetSpawnId);
+    }
+}
@@ -0,0 +1,88 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+[System.Serializable]
+public class RoomLink
+{
+    public string roomName;      // Scene name
+    public string[] neighbours = new string[0]; // Rooms one door away (links work both ways)
+}
+
+// Which rooms connect to which, loaded once from Resources/Config by RoomStreamingManager
+[CreateAssetMenu(fileName = "RoomGraph", menuName = "Game/Room Graph")]
+public class RoomGraph : ScriptableObject
+{
+    public List<RoomLink> rooms = new List<RoomLink>();
+
+    private Dictionary<string, List<string>> adjacency;
+    private readonly Queue<string> searchQueue = new Queue<string>();
+
+    void OnEnable()
+    {
+        BuildAdjacency();
+    }
+
+    void BuildAdjacency()
+    {
+        adjacency = new Dictionary<string, List<string>>();
+        foreach (RoomLink room in rooms)
+        {
+            if (room == null || string.IsNullOrEmpty(room.roomName)) continue;
+
+            foreach (string neighbour in room.neighbours)
+            {
+                if (string.IsNullOrEmpty(neighbour)) continue;
+                Link(room.roomName, neighbour);
+                Link(neighbour, room.roomName);
+            }
+        }
+    }
+
+    void Link(string from, string to)
+    {
+        if (!adjacency.TryGetValue(from, out List<string> neighbours))
+        {
+            neighbours = new List<string>();
+            adjacency[from] = neighbours;
+        }
+
+        if (!neighbours.Contains(to))
+            neighbours.Add(to);
+    }
+
+    public bool Contains(string roomName)
+    {
+        if (adjacency == null)
+            BuildAdjacency();
+
+        return roomName != null && adjacency.ContainsKey(roomName);
+    }
+
+    // Door count from origin to every room within maxDistance (origin included at 0)
+    public void GetRoomsWithin(string origin, int maxDistance, Dictionary<string, int> distances)
+    {
+        if (adjacency == null)
+            BuildAdjacency();
+
+        distances.Clear();
+        if (origin == null) return;
+
+        distances[origin] = 0;
+        searchQueue.Clear();
+        searchQueue.Enqueue(origin);
+
+        while (searchQueue.Count > 0)
+        {
+            string room = searchQueue.Dequeue();
+            int distance = distances[room];
+            if (distance >= maxDistance || !adjacency.TryGetValue(room, out List<string> neighbours)) continue;
+
+            foreach (string neighbour in neighbours)
+            {
+                if (distances.ContainsKey(neighbour)) continue;
+                distances[neighbour] = distance + 1;
+                searchQueue.Enqueue(neighbour);
+            }
+        }
+    }
+}
@@ -0,0 +1,243 @@
+using UnityEngine;
+using UnityEngine.Rendering.Universal;
+using System.Collections.Generic;
+
+// Per-room static lighting: lights that never move or flicker are rendered once into a
+// light texture, then replaced by a single Sprite Light2D using it as a cookie. The
+// baked light lands in the same light buffer as the candle and flickering lights, so
+// the room costs one light pass plus the dynamic ones.
+public class RoomLightBake : MonoBehaviour
+{
+    [Header("Static Lights")]
+    public List<Light2D> staticLights = new List<Light2D>();
+
+    [Header("Capture")]
+    public Rect roomBounds = new Rect(-16f, -9f, 32f, 18f);
+    public float pixelsPerUnit = 8f;   // Light texture resolution, lights are soft so this can be low
+    public int captureLayer = 31;      // Unused layer only the capture camera renders
+    public string captureSortingLayer = "Default";
+
+    [Header("Baked Result")]
+    public Sprite bakedLightSprite;
+    public float bakedIntensity = 1f;  // Peak value the texture was normalized by
+    public bool bakeOnLoad = true;     // Capture at Start when no texture was baked at build time
+
+    private Light2D bakedLight;
+    private Texture2D runtimeTexture;
+    private bool usingBake = false;
+
+    public bool UsingBake => usingBake;
+
+    void Start()
+    {
+        if (bakedLightSprite == null && bakeOnLoad && staticLights.Count > 0)
+        {
+            runtimeTexture = CaptureLightTexture(out bakedIntensity);
+            bakedLightSprite = CreateLightSprite(runtimeTexture);
+        }
+
+        if (bakedLightSprite != null)
+            UseBakedLighting(true);
+    }
+
+    void OnDestroy()
+    {
+        if (runtimeTexture != null)
+        {
+            Destroy(bakedLightSprite);
+            Destroy(runtimeTexture);
+        }
+    }
+
+    public void UseBakedLighting(bool useBake)
+    {
+        if (useBake && bakedLightSprite == null) return;
+
+        usingBake = useBake;
+
+        if (useBake && bakedLight == null)
+            bakedLight = CreateBakedLight();
+
+        if (bakedLight != null)
+        {
+            bakedLight.enabled = useBake;
+            if (useBake)
+                LightingOptimizer.Register(bakedLight, true);
+            else
+                LightingOptimizer.Unregister(bakedLight);
+        }
+
+        foreach (Light2D light in staticLights)
+        {
+            if (light == null) continue;
+
+            // Keep the budget manager from turning baked lights back on
+            if (useBake)
+            {
+                LightingOptimizer.Unregister(light);
+                light.enabled = false;
+            }
+            else
+            {
+                light.enabled = true;
+                if (light.TryGetComponent(out BudgetedLight2D budgeted))
+                    LightingOptimizer.Register(light, budgeted.alwaysOn, budgeted.externallyDriven);
+            }
+        }
+    }
+
+    [ContextMenu("Toggle Baked Lighting")]
+    void ToggleBakedLighting()
+    {
+        UseBakedLighting(!usingBake);
+        Debug.Log($"[RoomLightBake] {(usingBake ? "Baked" : "Realtime")} static lighting ({staticLights.Count} lights)");
+    }
+
+    Light2D CreateBakedLight()
+    {
+        GameObject lightObj = new GameObject("BakedRoomLight");
+        lightObj.transform.SetParent(transform, false);
+        lightObj.transform.position = new Vector3(roomBounds.center.x, roomBounds.center.y, 0f);
+
+        Light2D light = lightObj.AddComponent<Light2D>();
+        light.lightType = Light2D.LightType.Sprite;
+        light.lightCookieSprite = bakedLightSprite;
+        light.color = Color.white;
+        light.intensity = bakedIntensity;
+        light.shadowsEnabled = false; // Shadows are already in the texture
+
+        return light;
+    }
+
+    public Sprite CreateLightSprite(Texture2D texture)
+    {
+        return Sprite.Create(texture, new Rect(0, 0, texture.width, texture.height), new Vector2(0.5f, 0.5f), pixelsPerUnit);
+    }
+
+    // Renders only the static lights onto a white quad covering the room. The result is the
+    // light contribution per pixel, normalized to 0..1 with the peak returned separately.
+    public Texture2D CaptureLightTexture(out float peak)
+    {
+        int width = Mathf.Max(1, Mathf.CeilToInt(roomBounds.width * pixelsPerUnit));
+        int height = Mathf.Max(1, Mathf.CeilToInt(roomBounds.height * pixelsPerUnit));
+
+        // Everything but the static lights goes dark for the capture
+        Light2D[] sceneLights = FindObjectsByType<Light2D>(FindObjectsSortMode.None);
+        bool[] wasEnabled = new bool[sceneLights.Length];
+        for (int i = 0; i < sceneLights.Length; i++)
+        {
+            wasEnabled[i] = sceneLights[i].enabled;
+            sceneLights[i].enabled = staticLights.Contains(sceneLights[i]);
+        }
+        foreach (Light2D light in staticLights)
+        {
+            if (light != null)
+                light.enabled = true;
+        }
+
+        GameObject quadObj = new GameObject("LightCaptureQuad");
+        quadObj.layer = captureLayer;
+        quadObj.transform.position = new Vector3(roomBounds.center.x, roomBounds.center.y, 0f);
+        quadObj.transform.localScale = new Vector3(roomBounds.width, roomBounds.height, 1f);
+        Sprite whiteSprite = Sprite.Create(Texture2D.whiteTexture, new Rect(0, 0, Texture2D.whiteTexture.width, Texture2D.whiteTexture.height),
+                                           new Vector2(0.5f, 0.5f), Texture2D.whiteTexture.width);
+        SpriteRenderer quad = quadObj.AddComponent<SpriteRenderer>();
+        quad.sprite = whiteSprite;
+        quad.sortingLayerName = captureSortingLayer;
+
+        GameObject cameraObj = new GameObject("LightCaptureCamera");
+        cameraObj.transform.position = new Vector3(roomBounds.center.x, roomBounds.center.y, -10f);
+        Camera captureCamera = cameraObj.AddComponent<Camera>();
+        captureCamera.enabled = false;
+        captureCamera.orthographic = true;
+        captureCamera.orthographicSize = roomBounds.height * 0.5f;
+        captureCamera.cullingMask = 1 << captureLayer;
+        captureCamera.clearFlags = CameraClearFlags.SolidColor;
+        captureCamera.backgroundColor = Color.black;
+
+        RenderTexture target = RenderTexture.GetTemporary(width, height, 0, RenderTextureFormat.ARGBHalf, RenderTextureReadWrite.Linear);
+        captureCamera.targetTexture = target;
+        captureCamera.aspect = (float)width / height;
+        captureCamera.Render();
+
+        // One-off readback; this only runs at bake time or on room load
+        RenderTexture previous = RenderTexture.active;
+        RenderTexture.active = target;
+        Texture2D raw = new Texture2D(width, height, TextureFormat.RGBAHalf, false, true);
+        raw.ReadPixels(new Rect(0, 0, width, height), 0, 0);
+        raw.Apply();
+        RenderTexture.active = previous;
+
+        Color[] pixels = raw.GetPixels();
+        peak = 0f;
+        foreach (Color pixel in pixels)
+        {
+            peak = Mathf.Max(peak, pixel.maxColorComponent);
+        }
+
+        float scale = peak > 0f ? 1f / peak : 0f;
+        for (int i = 0; i < pixels.Length; i++)
+        {
+            Color pixel = pixels[i] * scale;
+            pixel.a = 1f;
+            pixels[i] = pixel;
+        }
+
+        Texture2D result = new Texture2D(width, height, TextureFormat.RGBA32, false, true);
+        result.name = $"{gameObject.scene.name}_BakedLight";
+        result.wrapMode = TextureWrapMode.Clamp;
+        result.SetPixels(pixels);
+        result.Apply();
+
+        // Restore the scene
+        captureCamera.targetTexture = null;
+        RenderTexture.ReleaseTemporary(target);
+        DestroyObject(raw);
+        DestroyObject(whiteSprite);
+        DestroyObject(quadObj);
+        DestroyObject(cameraObj);
+
+        for (int i = 0; i < sceneLights.Length; i++)
+        {
+            sceneLights[i].enabled = wasEnabled[i];
+        }
+
+        peak = Mathf.Max(peak, 0.0001f);
+        return result;
+    }
+
+    static void DestroyObject(Object obj)
+    {
+        if (Application.isPlaying)
+            Destroy(obj);
+        else
+            DestroyImmediate(obj);
+    }
+
+    // Lights that never move or change: everything except the player's candle and
+    // lights a flicker script drives
+    [ContextMenu("Collect Static Lights")]
+    public void CollectStaticLights()
+    {
+        staticLights.Clear();
+
+        foreach (Light2D light in FindObjectsByType<Light2D>(FindObjectsSortMode.None))
+        {
+            if (light.gameObject.scene != gameObject.scene) continue;
+            if (light.GetComponentInParent<PlayerLighting>() != null) continue;
+            if (light.transform.root.CompareTag("Player")) continue;
+            if (light.TryGetComponent(out BudgetedLight2D budgeted) && budgeted.externallyDriven) continue;
+            if (light == bakedLight) continue;
+
+            staticLights.Add(light);
+        }
+
+        Debug.Log($"[RoomLightBake] Collected {staticLights.Count} static lights in {gameObject.scene.name}");
+    }
+
+    void OnDrawGizmosSelected()
+    {
+        Gizmos.color = Color.yellow;
+        Gizmos.DrawWireCube(roomBounds.center, roomBounds.size);
+    }
+}
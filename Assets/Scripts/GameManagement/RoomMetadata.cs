@@ -0,0 +1,85 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+public enum InteractableKind
+{
+    Pickup,
+    Puzzle
+}
+
+[System.Serializable]
+public class TilemapBoundsEntry
+{
+    public string tilemapName;
+    public BoundsInt cellBounds;
+    public Bounds worldBounds;
+    public bool hasCollider;
+}
+
+[System.Serializable]
+public class InteractableEntry
+{
+    public string id;            // itemId / puzzleId
+    public InteractableKind kind;
+    public Vector2 position;
+}
+
+[System.Serializable]
+public class LightEntry
+{
+    public string lightName;
+    public Vector2 position;
+    public float outerRadius;
+    public bool budgeted;
+}
+
+[System.Serializable]
+public class SpawnPointEntry
+{
+    public string spawnId;
+    public Vector2 position;
+}
+
+[System.Serializable]
+public class UIAnchorEntry
+{
+    public string anchorName;
+    public Vector2 anchorMin;
+    public Vector2 anchorMax;
+    public Vector2 anchoredPosition;
+}
+
+// Everything a room's systems used to discover at Start, baked by
+// Tools/Rooms/Bake Room Metadata. Scene object references live on RoomContext.
+[CreateAssetMenu(fileName = "RoomMetadata", menuName = "Game/Room Metadata")]
+public class RoomMetadata : ScriptableObject
+{
+    public string sceneName;
+
+    [Header("Camera")]
+    public Bounds cameraBounds; // Combined world bounds of the camera boundary tilemaps
+
+    [Header("Tiles")]
+    public List<TilemapBoundsEntry> tilemaps = new List<TilemapBoundsEntry>();
+
+    [Header("Registry")]
+    public List<InteractableEntry> interactables = new List<InteractableEntry>();
+    public List<LightEntry> lights = new List<LightEntry>();
+    public List<SpawnPointEntry> spawnPoints = new List<SpawnPointEntry>();
+    public List<UIAnchorEntry> uiAnchors = new List<UIAnchorEntry>();
+
+    public bool TryGetSpawnPoint(string spawnId, out Vector2 position)
+    {
+        foreach (SpawnPointEntry entry in spawnPoints)
+        {
+            if (entry.spawnId == spawnId)
+            {
+                position = entry.position;
+                return true;
+            }
+        }
+
+        position = Vector2.zero;
+        return false;
+    }
+}
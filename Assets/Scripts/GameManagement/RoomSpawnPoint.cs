@@ -0,0 +1,13 @@
+using UnityEngine;
+
+// Named entry position in a room, baked into RoomMetadata.spawnPoints
+public class RoomSpawnPoint : MonoBehaviour
+{
+    public string spawnId = "Default";
+
+    void OnDrawGizmos()
+    {
+        Gizmos.color = Color.green;
+        Gizmos.DrawWireSphere(transform.position, 0.3f);
+    }
+}
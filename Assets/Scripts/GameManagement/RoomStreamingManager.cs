@@ -0,0 +1,433 @@
+using UnityEngine;
+using UnityEngine.SceneManagement;
+using System.Collections;
+using System.Collections.Generic;
+
+// Keeps the current room active and its neighbours loaded additively in the
+// background, so a door swaps rooms without a blocking load. Neighbours are
+// loaded fully but kept asleep: RoomContext deactivates the scene's roots in its
+// Awake, so nothing else in the room wakes up until the player walks in. A room
+// without a RoomContext can only be put to sleep after its Awakes have run, so it is
+// loaded on demand instead of preloaded. Rooms further than unloadRadius doors away
+// are unloaded.
+public class RoomStreamingManager : PersistentSingleton<RoomStreamingManager>
+{
+    [Header("Graph")]
+    public string graphPath = "Config/RoomGraph"; // Under Resources
+
+    [Header("Streaming")]
+    public int preloadRadius = 1; // Rooms this many doors away are loaded ahead of time
+    public int unloadRadius = 2;  // Rooms further away than this are unloaded
+    // Per-frame main thread time spent integrating background loads:
+    // Low ~2 ms, BelowNormal ~4 ms, Normal ~10 ms, High ~50 ms
+    public ThreadPriority preloadPriority = ThreadPriority.Low;
+    public ThreadPriority transitionPriority = ThreadPriority.High; // Player is waiting on the room
+
+    [Header("Debug")]
+    public bool logStreaming = true;
+
+    enum RoomState
+    {
+        Loading,
+        Asleep,
+        Active,
+        Unloading
+    }
+
+    class StreamedRoom
+    {
+        public string name;
+        public RoomState state;
+        public Scene scene;
+        public RoomContext context;
+        public float loadStart;
+        public bool bundled; // Holds a RoomBundleManager reference, released on unload
+        public readonly List<GameObject> sleptRoots = new List<GameObject>(); // Roots that were active
+    }
+
+    private RoomGraph graph;
+    private readonly Dictionary<string, StreamedRoom> rooms = new Dictionary<string, StreamedRoom>();
+    private readonly Dictionary<string, int> distances = new Dictionary<string, int>();
+    private readonly List<StreamedRoom> unloadScratch = new List<StreamedRoom>();
+    private readonly HashSet<string> roomsWithoutContext = new HashSet<string>(); // Not preloaded again
+    private StreamedRoom currentRoom;
+    private string pendingRoom; // Door taken before the room finished loading
+    private string pendingSpawnId;
+
+    // Raised after a streamed room wakes up and becomes the active scene
+    public static event System.Action<string> OnRoomActivated;
+
+    public string CurrentRoom => currentRoom != null ? currentRoom.name : null;
+
+    protected override void OnSingletonAwake()
+    {
+        graph = Resources.Load<RoomGraph>(graphPath);
+        if (graph == null)
+            Debug.LogWarning($"[RoomStreamingManager] No RoomGraph at Resources/{graphPath} - rooms load one at a time");
+
+        SceneManager.sceneLoaded += OnSceneLoaded;
+        SceneManager.sceneUnloaded += OnSceneUnloaded;
+        Application.backgroundLoadingPriority = preloadPriority;
+    }
+
+    protected override void OnSingletonDestroy()
+    {
+        SceneManager.sceneLoaded -= OnSceneLoaded;
+        SceneManager.sceneUnloaded -= OnSceneUnloaded;
+    }
+
+    // Called from RoomContext.Awake: a room loaded as a neighbour goes straight to sleep
+    // before the rest of its objects run Awake
+    public static bool SleepIfPreloading(RoomContext context)
+    {
+        if (!HasInstance) return false;
+
+        Scene scene = context.gameObject.scene;
+        if (!Instance.rooms.TryGetValue(scene.name, out StreamedRoom room) || room.state != RoomState.Loading)
+            return false;
+
+        room.scene = scene;
+        room.context = context;
+        Instance.DeactivateRoots(room);
+        return true;
+    }
+
+    // Called from RoomContext.Start; adopts a room that was loaded directly (bootstrap,
+    // save load, playing a scene in the editor)
+    public void OnRoomStarted(RoomContext context)
+    {
+        AdoptRoom(context.gameObject.scene, context);
+    }
+
+    // Rooms without a RoomContext are adopted from OnSceneLoaded instead
+    void AdoptRoom(Scene scene, RoomContext context)
+    {
+        string roomName = scene.name;
+        if (currentRoom != null && currentRoom.name == roomName) return;
+        if (rooms.TryGetValue(roomName, out StreamedRoom known) && known.state != RoomState.Active) return;
+
+        StreamedRoom room = known ?? new StreamedRoom { name = roomName };
+        room.state = RoomState.Active;
+        room.scene = scene;
+        room.context = context;
+        // Whoever loaded it (bootstrap, save load) acquired its bundles; the room owns them now
+        room.bundled = RoomBundleManager.HasInstance && RoomBundleManager.Instance.HasRoom(roomName);
+        rooms[roomName] = room;
+        currentRoom = room;
+
+        RoomAudioManager.Instance?.EnterRoom(roomName);
+        UpdateStreaming();
+    }
+
+    // Door transition. Swaps immediately when the room is already asleep in memory,
+    // otherwise loads it at transition priority and swaps as soon as it arrives.
+    public void EnterRoom(string roomName, string spawnId = null)
+    {
+        if (string.IsNullOrEmpty(roomName) || (currentRoom != null && currentRoom.name == roomName)) return;
+
+        if (!CanLoad(roomName))
+        {
+            Debug.LogError($"[RoomStreamingManager] {roomName} is not in the build");
+            return;
+        }
+
+        rooms.TryGetValue(roomName, out StreamedRoom room);
+        if (room != null && room.state == RoomState.Asleep)
+        {
+            Activate(room, spawnId);
+            return;
+        }
+
+        pendingRoom = roomName;
+        pendingSpawnId = spawnId;
+        Application.backgroundLoadingPriority = transitionPriority;
+
+        if (room == null)
+            BeginLoad(roomName);
+        else if (room.state == RoomState.Unloading && logStreaming)
+            Debug.Log($"[RoomStreamingManager] {roomName} is unloading, reloading once it's gone");
+
+        if (logStreaming)
+            Debug.Log($"[RoomStreamingManager] Waiting on {roomName} - not preloaded in time");
+    }
+
+    void Activate(StreamedRoom room, string spawnId)
+    {
+        float start = Time.realtimeSinceStartup;
+        StreamedRoom previous = currentRoom;
+
+        if (previous != null && previous.state == RoomState.Active)
+            Sleep(previous);
+
+        // Active first, so anything the room creates while waking up lands in it
+        SceneManager.SetActiveScene(room.scene);
+        Wake(room);
+        currentRoom = room;
+        PlacePlayer(room, spawnId);
+
+        pendingRoom = null;
+        pendingSpawnId = null;
+        Application.backgroundLoadingPriority = preloadPriority;
+
+        SaveSystem.Instance?.OnRoomEntered(room.name);
+        RoomAudioManager.Instance?.EnterRoom(room.name);
+        OnRoomActivated?.Invoke(room.name);
+
+        if (logStreaming)
+            Debug.Log($"[RoomStreamingManager] {previous?.name ?? "(none)"} -> {room.name} in {(Time.realtimeSinceStartup - start) * 1000f:F1} ms");
+
+        UpdateStreaming();
+    }
+
+    void Sleep(StreamedRoom room)
+    {
+        DeactivateRoots(room);
+        room.state = RoomState.Asleep;
+    }
+
+    void DeactivateRoots(StreamedRoom room)
+    {
+        room.sleptRoots.Clear();
+        foreach (GameObject root in room.scene.GetRootGameObjects())
+        {
+            if (!root.activeSelf) continue;
+            room.sleptRoots.Add(root);
+            root.SetActive(false);
+        }
+    }
+
+    void Wake(StreamedRoom room)
+    {
+        room.context?.OnWake();
+
+        foreach (GameObject root in room.sleptRoots)
+        {
+            if (root != null)
+                root.SetActive(true);
+        }
+        room.sleptRoots.Clear();
+        room.state = RoomState.Active;
+    }
+
+    void PlacePlayer(StreamedRoom room, string spawnId)
+    {
+        if (string.IsNullOrEmpty(spawnId)) return;
+
+        Transform player = room.context != null ? room.context.player : FindPlayer(room.scene);
+        if (player == null) return;
+
+        Vector2 position;
+        if (room.context == null || room.context.metadata == null || !room.context.metadata.TryGetSpawnPoint(spawnId, out position))
+        {
+            RoomContext.ReportFallback($"Spawn point {spawnId}");
+            if (!FindSpawnPoint(room.scene, spawnId, out position))
+            {
+                Debug.LogWarning($"[RoomStreamingManager] {room.name} has no spawn point {spawnId}");
+                return;
+            }
+        }
+
+        player.position = new Vector3(position.x, position.y, player.position.z);
+
+        Rigidbody2D body = player.GetComponent<Rigidbody2D>();
+        if (body != null)
+            body.position = position;
+    }
+
+    static Transform FindPlayer(Scene scene)
+    {
+        RoomContext.ReportFallback("Streamed room player");
+        foreach (GameObject root in scene.GetRootGameObjects())
+        {
+            if (root.CompareTag("Player"))
+                return root.transform;
+        }
+        return null;
+    }
+
+    static RoomContext FindContext(Scene scene)
+    {
+        foreach (GameObject root in scene.GetRootGameObjects())
+        {
+            RoomContext context = root.GetComponentInChildren<RoomContext>(true);
+            if (context != null)
+                return context;
+        }
+        return null;
+    }
+
+    static bool FindSpawnPoint(Scene scene, string spawnId, out Vector2 position)
+    {
+        foreach (GameObject root in scene.GetRootGameObjects())
+        {
+            foreach (RoomSpawnPoint spawnPoint in root.GetComponentsInChildren<RoomSpawnPoint>(true))
+            {
+                if (spawnPoint.spawnId == spawnId)
+                {
+                    position = spawnPoint.transform.position;
+                    return true;
+                }
+            }
+        }
+
+        position = Vector2.zero;
+        return false;
+    }
+
+    // Loads neighbours within preloadRadius, unloads anything beyond unloadRadius
+    void UpdateStreaming()
+    {
+        if (graph == null || currentRoom == null) return;
+
+        graph.GetRoomsWithin(currentRoom.name, Mathf.Max(preloadRadius, unloadRadius), distances);
+
+        foreach (KeyValuePair<string, int> entry in distances)
+        {
+            if (entry.Value == 0 || entry.Value > preloadRadius || rooms.ContainsKey(entry.Key)) continue;
+            if (roomsWithoutContext.Contains(entry.Key)) continue;
+
+            if (CanLoad(entry.Key))
+                BeginLoad(entry.Key);
+        }
+
+        unloadScratch.Clear();
+        foreach (StreamedRoom room in rooms.Values)
+        {
+            if (room.state != RoomState.Asleep || room.name == pendingRoom) continue;
+            if (!distances.TryGetValue(room.name, out int distance) || distance > unloadRadius)
+                unloadScratch.Add(room);
+        }
+
+        foreach (StreamedRoom room in unloadScratch)
+        {
+            room.state = RoomState.Unloading;
+            SceneManager.UnloadSceneAsync(room.scene);
+
+            if (logStreaming)
+                Debug.Log($"[RoomStreamingManager] Unloading {room.name}");
+        }
+    }
+
+    // In the player build, or shipped as a room bundle
+    static bool CanLoad(string roomName)
+    {
+        return Application.CanStreamedLevelBeLoaded(roomName)
+            || (RoomBundleManager.HasInstance && RoomBundleManager.Instance.HasRoom(roomName));
+    }
+
+    void BeginLoad(string roomName)
+    {
+        StreamedRoom room = new StreamedRoom { name = roomName, state = RoomState.Loading, loadStart = Time.realtimeSinceStartup };
+        rooms[roomName] = room;
+
+        if (logStreaming)
+            Debug.Log($"[RoomStreamingManager] Loading {roomName} in the background");
+
+        RoomBundleManager bundles = RoomBundleManager.HasInstance ? RoomBundleManager.Instance : null;
+        if (bundles != null && bundles.HasRoom(roomName))
+        {
+            room.bundled = true;
+            bundles.Acquire(roomName);
+            StartCoroutine(LoadSceneWhenBundled(room));
+            return;
+        }
+
+        LoadScene(room);
+    }
+
+    IEnumerator LoadSceneWhenBundled(StreamedRoom room)
+    {
+        while (!RoomBundleManager.Instance.IsReady(room.name))
+            yield return null;
+
+        if (room.state == RoomState.Loading && rooms.ContainsKey(room.name))
+            LoadScene(room);
+    }
+
+    void LoadScene(StreamedRoom room)
+    {
+        // Activation stays on: a held activation would block every load queued behind it
+        SceneManager.LoadSceneAsync(room.name, LoadSceneMode.Additive);
+    }
+
+    void ReleaseBundles(StreamedRoom room)
+    {
+        if (!room.bundled) return;
+
+        room.bundled = false;
+        if (RoomBundleManager.HasInstance)
+            RoomBundleManager.Instance.Release(room.name);
+    }
+
+    void OnSceneLoaded(Scene scene, LoadSceneMode mode)
+    {
+        // A blocking load (new game, save in another room) replaced everything
+        if (mode == LoadSceneMode.Single)
+        {
+            // Unloaded rooms already gave their bundles back; rooms still waiting on theirs didn't
+            StopAllCoroutines();
+            foreach (StreamedRoom stale in rooms.Values)
+                ReleaseBundles(stale);
+
+            rooms.Clear();
+            currentRoom = null;
+            pendingRoom = null;
+            Application.backgroundLoadingPriority = preloadPriority;
+        }
+
+        if (!rooms.TryGetValue(scene.name, out StreamedRoom room))
+        {
+            // Loaded directly; a room with a RoomContext adopts itself from Start
+            if (graph != null && graph.Contains(scene.name) && FindContext(scene) == null)
+                AdoptRoom(scene, null);
+            return;
+        }
+
+        if (room.state != RoomState.Loading) return;
+
+        // Rooms without a RoomContext were not put to sleep in Awake; do it now, before Start
+        room.scene = scene;
+        if (room.context == null)
+        {
+            if (roomsWithoutContext.Add(scene.name))
+                Debug.LogWarning($"[RoomStreamingManager] {scene.name} has no RoomContext - its Awake ran while loading, so it won't be preloaded again. " +
+                                 "Run Tools/Rooms/Bake Room Metadata on it");
+            DeactivateRoots(room);
+        }
+        room.state = RoomState.Asleep;
+
+        if (logStreaming)
+            Debug.Log($"[RoomStreamingManager] {scene.name} ready (asleep) after {(Time.realtimeSinceStartup - room.loadStart) * 1000f:F0} ms");
+
+        if (pendingRoom == scene.name)
+            Activate(room, pendingSpawnId);
+    }
+
+    void OnSceneUnloaded(Scene scene)
+    {
+        if (!rooms.TryGetValue(scene.name, out StreamedRoom room)) return;
+
+        // Also for rooms replaced by a blocking load, which never went through Unloading
+        ReleaseBundles(room);
+        if (room.state != RoomState.Unloading) return;
+
+        rooms.Remove(scene.name);
+
+        // Let the next room change (or this one) reclaim the unloaded room's assets
+        Resources.UnloadUnusedAssets();
+
+        // Door taken back into the room while it was unloading
+        if (pendingRoom == scene.name)
+            BeginLoad(scene.name);
+    }
+
+    [ContextMenu("Log Rooms")]
+    void LogRooms()
+    {
+        System.Text.StringBuilder report = new System.Text.StringBuilder();
+        foreach (StreamedRoom room in rooms.Values)
+            report.Append($"\n  {room.name}: {room.state}");
+
+        Debug.Log($"[RoomStreamingManager] Current {CurrentRoom ?? "(none)"}, priority {Application.backgroundLoadingPriority}{report}");
+    }
+}
@@ -0,0 +1,15 @@
+using UnityEngine;
+using UnityEngine.UI;
+
+// References inside the SaveLoadPanel prefab, bound by SaveUIManager once loaded.
+// The slot prefab lives here so it only loads with the panel.
+public class SaveMenuView : MonoBehaviour
+{
+    [Header("Save Slots")]
+    public GameObject saveSlotPrefab;
+    public Transform slotParent;
+
+    [Header("Buttons")]
+    public Button closePanelButton;
+    public Button newGameButton;
+}
@@ -61,7 +61,7 @@ public class RoomState
     public bool hasBeenVisited = false;
 }
 
-public class SaveSystem : MonoBehaviour
+public class SaveSystem : MonoBehaviour, ITweenCallback
 {
     [Header("Save Settings")]
     public int maxSaveSlots = 3;
@@ -77,9 +77,14 @@ public class SaveSystem : MonoBehaviour
 
     public static SaveSystem Instance { get; private set; }
 
+    // Set by GameBootstrap, which reads the continue slot on a worker thread
+    private static int preloadedSlot = -1;
+    private static GameSaveData preloadedSave;
+
     // Events
     public System.Action<GameSaveData> OnGameLoaded;
     public System.Action<GameSaveData> OnGameSaved;
+    public System.Action<int> OnLullabyProgressChanged; // Fragment count
 
     void Awake()
     {
@@ -100,7 +105,17 @@ public class SaveSystem : MonoBehaviour
         sessionStartTime = Time.time;
 
         // Try to load existing save or create new one
-        if (HasSaveFile(1))
+        if (preloadedSlot >= 0)
+        {
+            if (preloadedSave != null)
+                ApplySave(preloadedSlot, preloadedSave);
+            else
+                CreateNewGame();
+
+            preloadedSlot = -1;
+            preloadedSave = null;
+        }
+        else if (HasSaveFile(1))
         {
             LoadGame(1);
         }
@@ -139,12 +154,12 @@ public class SaveSystem : MonoBehaviour
         }
     }
 
-    string GetSavePath()
+    static string GetSavePath()
     {
         return Path.Combine(Application.persistentDataPath, "Saves");
     }
 
-    string GetSaveFilePath(int slot)
+    public static string GetSaveFilePath(int slot)
     {
         return Path.Combine(GetSavePath(), $"save_slot_{slot}.json");
     }
@@ -174,6 +189,7 @@ public class SaveSystem : MonoBehaviour
         currentSaveData = new GameSaveData();
         currentSaveData.saveName = "New Game";
 
+        OnLullabyProgressChanged?.Invoke(currentSaveData.lullabySongProgress);
         Debug.Log("Created new game save data");
     }
 
@@ -249,13 +265,7 @@ public class SaveSystem : MonoBehaviour
         try
         {
             string json = File.ReadAllText(filePath);
-            currentSaveData = JsonUtility.FromJson<GameSaveData>(json);
-
-            // Apply loaded data to game
-            ApplyLoadedData();
-
-            Debug.Log($"Game loaded from slot {slot}");
-            OnGameLoaded?.Invoke(currentSaveData);
+            ApplySave(slot, JsonUtility.FromJson<GameSaveData>(json));
             return true;
         }
         catch (Exception e)
@@ -265,6 +275,24 @@ public class SaveSystem : MonoBehaviour
         }
     }
 
+    // data == null means the slot was empty
+    public static void ProvidePreloadedSave(int slot, GameSaveData data)
+    {
+        preloadedSlot = slot;
+        preloadedSave = data;
+    }
+
+    void ApplySave(int slot, GameSaveData data)
+    {
+        currentSaveData = data;
+
+        // Apply loaded data to game
+        ApplyLoadedData();
+
+        Debug.Log($"Game loaded from slot {slot}");
+        OnGameLoaded?.Invoke(currentSaveData);
+    }
+
     public bool DeleteSave(int slot)
     {
         string filePath = GetSaveFilePath(slot);
@@ -329,20 +357,22 @@ public class SaveSystem : MonoBehaviour
         string currentScene = UnityEngine.SceneManagement.SceneManager.GetActiveScene().name;
         if (currentScene != currentSaveData.currentScene)
         {
+            RoomBundleManager.Instance?.Acquire(currentSaveData.currentScene, true);
             UnityEngine.SceneManagement.SceneManager.LoadScene(currentSaveData.currentScene);
         }
 
         // Apply player position (after scene loads)
-        StartCoroutine(ApplyPlayerPositionDelayed());
+        TweenScheduler tweens = TweenScheduler.Instance;
+        if (tweens != null)
+            tweens.OnComplete(tweens.Delay(0f, true), this);
 
         // Apply audio settings
         ApplyAudioSettings();
     }
 
-    System.Collections.IEnumerator ApplyPlayerPositionDelayed()
+    // Delay from ApplyLoadedData finished - the next frame, once the scene has loaded
+    public void OnTweenComplete(int tag)
     {
-        yield return new WaitForEndOfFrame();
-
         if (player != null && currentSaveData != null)
         {
             player.position = currentSaveData.playerPosition;
@@ -372,6 +402,7 @@ public class SaveSystem : MonoBehaviour
         {
             currentSaveData.collectedMemoryFragments.Add(fragmentId);
             currentSaveData.lullabySongProgress = currentSaveData.collectedMemoryFragments.Count;
+            OnLullabyProgressChanged?.Invoke(currentSaveData.lullabySongProgress);
         }
     }
 
@@ -1,40 +1,57 @@
 using UnityEngine;
 using UnityEngine.UI;
 using TMPro;
+using System.Collections;
 using System.Collections.Generic;
 
 public class SaveUIManager : MonoBehaviour
 {
     [Header("UI Panels")]
-    public GameObject saveLoadPanel;
-
-    [Header("Save Slot Prefab")]
-    public GameObject saveSlotPrefab;
-    public Transform slotParent; // Single parent for all slots
-
-    [Header("Buttons")]
-    public Button closePanelButton;
-    public Button newGameButton;
+    public string panelPath = "UI/Menus/SaveLoadPanel"; // Under Resources, loaded on first open
+    public float releaseAfterSeconds = 30f;             // Unloaded once closed this long
 
     private List<SaveSlotUI> saveSlots = new List<SaveSlotUI>();
     private bool wasOpenedFromPauseMenu = false;
+    private bool isOpen = false;
+
+    private LazyMenuPanel<SaveMenuView> saveMenu;
+    private SaveMenuView view; // Set once bound
 
-    void Start()
+    void Awake()
     {
-        SetupUI();
-        CreateSaveSlots();
+        saveMenu = new LazyMenuPanel<SaveMenuView>(panelPath, transform);
+    }
+
+    // Wires a freshly loaded panel; runs once per load
+    void BindSaveMenu(SaveMenuView loadedView)
+    {
+        view = loadedView;
+
+        if (view.closePanelButton != null)
+            view.closePanelButton.onClick.AddListener(CloseSaveLoadPanel);
+
+        if (view.newGameButton != null)
+            view.newGameButton.onClick.AddListener(StartNewGame);
 
-        if (saveLoadPanel != null)
-            saveLoadPanel.SetActive(false);
+        saveSlots.Clear();
+        CreateSaveSlots();
     }
 
-    void SetupUI()
+    IEnumerator ShowSaveMenu()
     {
-        if (closePanelButton != null)
-            closePanelButton.onClick.AddListener(CloseSaveLoadPanel);
+        if (view == null)
+        {
+            yield return saveMenu.Load();
+            if (saveMenu.View == null) yield break;
+            BindSaveMenu(saveMenu.View);
+        }
 
-        if (newGameButton != null)
-            newGameButton.onClick.AddListener(StartNewGame);
+        // Closed again while the panel was loading
+        if (!isOpen) yield break;
+
+        saveMenu.MarkOpen();
+        view.gameObject.SetActive(true);
+        RefreshSlots();
     }
 
     void CreateSaveSlots()
@@ -56,9 +73,9 @@ public class SaveUIManager : MonoBehaviour
 
     void CreateSaveSlot(int slotIndex, bool canSave)
     {
-        if (saveSlotPrefab == null || slotParent == null) return;
+        if (view.saveSlotPrefab == null || view.slotParent == null) return;
 
-        GameObject slotObj = Instantiate(saveSlotPrefab, slotParent);
+        GameObject slotObj = Instantiate(view.saveSlotPrefab, view.slotParent);
         SaveSlotUI slotUI = slotObj.GetComponent<SaveSlotUI>();
 
         if (slotUI == null)
@@ -84,10 +101,10 @@ public class SaveUIManager : MonoBehaviour
 
     public void OpenSaveLoadPanel()
     {
-        if (saveLoadPanel != null)
-        {
-            saveLoadPanel.SetActive(true);
-        }
+        if (isOpen) return;
+
+        isOpen = true;
+        StartCoroutine(ShowSaveMenu());
 
         // Check if opened from pause menu
         wasOpenedFromPauseMenu = PauseMenuManager.Instance != null && PauseMenuManager.Instance.IsPaused();
@@ -98,13 +115,20 @@ public class SaveUIManager : MonoBehaviour
             Time.timeScale = 0f;
         }
 
-        RefreshSlots();
+        FramePacingManager.Instance?.RequestIdle("SaveMenu");
     }
 
     public void CloseSaveLoadPanel()
     {
-        if (saveLoadPanel != null)
-            saveLoadPanel.SetActive(false);
+        if (!isOpen) return;
+
+        isOpen = false;
+        if (view != null)
+            view.gameObject.SetActive(false);
+        saveMenu.MarkClosed();
+
+        if (FramePacingManager.HasInstance)
+            FramePacingManager.Instance.ReleaseIdle("SaveMenu");
 
         // Only resume game if we paused it (not if pause menu is handling it)
         if (!wasOpenedFromPauseMenu)
@@ -199,6 +223,7 @@ public class SaveUIManager : MonoBehaviour
             }
 
             // Load first scene
+            RoomBundleManager.Instance?.Acquire("Room01_Foyer", true);
             UnityEngine.SceneManagement.SceneManager.LoadScene("Room01_Foyer");
         }
     }
@@ -235,7 +260,7 @@ public class SaveUIManager : MonoBehaviour
         // ESC to toggle save menu (only if pause menu is not handling it)
         if (Input.GetKeyDown(KeyCode.S) && PauseMenuManager.Instance == null)
         {
-            if (saveLoadPanel != null && saveLoadPanel.activeSelf)
+            if (isOpen)
             {
                 CloseSaveLoadPanel();
             }
@@ -264,5 +289,13 @@ public class SaveUIManager : MonoBehaviour
                 Debug.Log("Quick loaded from slot 1");
             }
         }
+
+        // The pause menu keeps it around while it's up
+        bool pauseMenuOpen = PauseMenuManager.Instance != null && PauseMenuManager.Instance.IsPaused();
+        if (!isOpen && !pauseMenuOpen && saveMenu.ReleaseIfIdle(releaseAfterSeconds))
+        {
+            view = null;
+            saveSlots.Clear();
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,28 @@
+using UnityEngine;
+using UnityEngine.UI;
+using TMPro;
+
+// References inside the SettingsPanel prefab, bound by PauseMenuManager once loaded
+public class SettingsMenuView : MonoBehaviour
+{
+    [Header("Navigation")]
+    public Button backFromSettingsButton;
+    public Button audioTabButton;
+    public Button videoTabButton;
+
+    [Header("Audio Settings")]
+    public GameObject audioSettingsPanel;
+    public Slider sfxVolumeSlider;
+    public Slider dialogueVolumeSlider;
+    public Slider musicVolumeSlider;
+    public TextMeshProUGUI sfxValueText;
+    public TextMeshProUGUI dialogueValueText;
+    public TextMeshProUGUI musicValueText;
+
+    [Header("Video Settings")]
+    public GameObject videoSettingsPanel;
+    public Slider brightnessSlider;
+    public Slider contrastSlider;
+    public TextMeshProUGUI brightnessValueText;
+    public TextMeshProUGUI contrastValueText;
+}
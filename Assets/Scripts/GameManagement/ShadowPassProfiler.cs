@@ -0,0 +1,59 @@
+using UnityEngine;
+using System.Collections;
+using System.Text;
+
+// Before/after numbers for the baked wall casters: toggles every BakedShadowCasters
+// root between original and merged casters and samples the render counters for each.
+public class ShadowPassProfiler : BakeComparison<BakedShadowCasters, ShadowPassProfiler.PassStats>
+{
+    [Header("Markers")]
+    public string shadowMarkerName = "Draw2DShadows"; // URP 2D shadow pass sampler
+
+    public struct PassStats
+    {
+        public RenderStatsRecorder.Result render; // markerMs is the shadow pass time
+        public double visibleShadowCasters;
+    }
+
+    protected override string BakeMenu => "Tools/Lighting/Bake Static Shadow Casters";
+
+    protected override IEnumerator Sample(bool baked, System.Action<PassStats> onDone)
+    {
+        PassStats stats = new PassStats();
+
+        yield return SampleRenderStats(shadowMarkerName,
+            () =>
+            {
+                if (LightingOptimizer.Instance != null)
+                    stats.visibleShadowCasters += Mathf.Max(0, LightingOptimizer.Instance.VisibleShadowCount);
+            },
+            result => stats.render = result);
+
+        stats.visibleShadowCasters /= Mathf.Max(1, sampleCount);
+        onDone(stats);
+    }
+
+    protected override string BuildReport()
+    {
+        int tiles = 0;
+        int replaced = 0;
+        int baked = 0;
+        int vertices = 0;
+
+        foreach (BakedShadowCasters root in BakedShadowCasters.Active)
+        {
+            tiles += root.sourceTileCount;
+            replaced += root.replacedCasters.Count;
+            baked += root.bakedCasterCount;
+            vertices += root.bakedVertexCount;
+        }
+
+        StringBuilder report = new StringBuilder();
+        report.AppendLine($"[ShadowPassProfiler] {UnityEngine.SceneManagement.SceneManager.GetActiveScene().name}: " +
+                          $"{tiles} wall tiles, {replaced} original casters -> {baked} baked casters ({vertices} verts)");
+        report.AppendLine($"  Before: {Before.render}, visible casters {Before.visibleShadowCasters:F1}");
+        report.Append($"  After : {After.render}, visible casters {After.visibleShadowCasters:F1}");
+
+        return report.ToString();
+    }
+}
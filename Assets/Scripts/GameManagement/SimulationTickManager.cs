@@ -0,0 +1,145 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+// Owns the fixed simulation tick. Movement is applied in FixedUpdate at tickRate and
+// rendered with Rigidbody2D interpolation, so the tick can drop (e.g. 30 Hz on battery
+// saver) without visible stutter at 60/120 fps.
+//
+// Idle skipping is opt-in per room (RoomContext.skipIdlePhysics): while on, 2D physics only
+// steps while a registered body moves, so unregistered bodies and triggers freeze whenever
+// the registered ones are idle. Rooms with those leave it off, or set alwaysSimulate.
+[DefaultExecutionOrder(1000)] // FixedUpdate after movers have written their velocities
+public class SimulationTickManager : PersistentSingleton<SimulationTickManager>
+{
+    [Header("Tick Rate")]
+    public int normalTickRate = 50;
+    public int batterySaverTickRate = 30;
+
+    [Header("Battery Saver")]
+    public bool batterySaver = false;
+    public bool autoBatterySaver = true;
+    [Range(0f, 1f)]
+    public float lowBatteryThreshold = 0.2f;
+    public float batteryCheckInterval = 10f;
+
+    [Header("Physics")]
+    public bool skipIdleSteps = false; // Set by the awake room; stop stepping Physics2D while no registered body moves
+    public bool alwaysSimulate = false; // Set if the room has unregistered dynamic bodies
+
+    private List<Rigidbody2D> bodies = new List<Rigidbody2D>();
+    private float batteryTimer;
+    private bool batterySaverChosen; // Set from the settings; the auto check leaves it alone
+    private bool simulating = false;
+
+    private const string BatterySaverKey = "BatterySaver";
+
+    public int CurrentTickRate => batterySaver ? batterySaverTickRate : normalTickRate;
+    public bool IsSimulating => simulating;
+
+    protected override void OnSingletonAwake()
+    {
+        batterySaverChosen = PlayerPrefs.HasKey(BatterySaverKey);
+        batterySaver = PlayerPrefs.GetInt(BatterySaverKey, batterySaver ? 1 : 0) == 1;
+        ApplyTickRate();
+        SetSimulating(true);
+    }
+
+    public void Register(Rigidbody2D body)
+    {
+        if (body != null && !bodies.Contains(body))
+        {
+            bodies.Add(body);
+        }
+    }
+
+    public void Unregister(Rigidbody2D body)
+    {
+        bodies.Remove(body);
+    }
+
+    public void SetBatterySaver(bool enabled)
+    {
+        batterySaver = enabled;
+        batterySaverChosen = true;
+        PlayerPrefs.SetInt(BatterySaverKey, enabled ? 1 : 0);
+        ApplyTickRate();
+    }
+
+    // Hands battery saver back to the battery level check
+    public void ClearBatterySaverChoice()
+    {
+        batterySaverChosen = false;
+        PlayerPrefs.DeleteKey(BatterySaverKey);
+        batteryTimer = batteryCheckInterval;
+    }
+
+    void ApplyTickRate()
+    {
+        int tickRate = Mathf.Max(1, CurrentTickRate);
+        Time.fixedDeltaTime = 1f / tickRate;
+    }
+
+    void Update()
+    {
+        if (!autoBatterySaver || batterySaverChosen) return;
+
+        batteryTimer += Time.unscaledDeltaTime;
+        if (batteryTimer < batteryCheckInterval) return;
+        batteryTimer = 0f;
+
+        bool lowBattery = SystemInfo.batteryStatus == BatteryStatus.Discharging &&
+                          SystemInfo.batteryLevel >= 0f &&
+                          SystemInfo.batteryLevel <= lowBatteryThreshold;
+
+        if (lowBattery != batterySaver)
+        {
+            batterySaver = lowBattery;
+            ApplyTickRate();
+        }
+    }
+
+    void FixedUpdate()
+    {
+        if (!skipIdleSteps || alwaysSimulate)
+        {
+            SetSimulating(true);
+            return;
+        }
+
+        // Physics2D steps after script FixedUpdate, so this decides the current step
+        SetSimulating(AnyBodyMoving());
+    }
+
+    bool AnyBodyMoving()
+    {
+        for (int i = bodies.Count - 1; i >= 0; i--)
+        {
+            Rigidbody2D body = bodies[i];
+            if (body == null)
+            {
+                bodies.RemoveAt(i);
+                continue;
+            }
+
+            if (body.linearVelocity.sqrMagnitude > 0.0001f || body.angularVelocity != 0f)
+                return true;
+        }
+
+        return false;
+    }
+
+    void SetSimulating(bool enabled)
+    {
+        if (simulating == enabled) return;
+
+        simulating = enabled;
+
+        // Script mode with no Simulate() calls means no 2D physics work at all
+        Physics2D.simulationMode = enabled ? SimulationMode2D.FixedUpdate : SimulationMode2D.Script;
+    }
+
+    protected override void OnSingletonDestroy()
+    {
+        Physics2D.simulationMode = SimulationMode2D.FixedUpdate;
+    }
+}
@@ -0,0 +1,82 @@
+using UnityEngine;
+using System.Collections.Generic;
+using System.IO;
+
+[System.Serializable]
+public class StartupPhase
+{
+    public string name;
+    public string dependsOn; // Comma separated, empty for roots
+    public double startMs;   // Since process start
+    public double endMs;
+    public bool failed;
+
+    public double DurationMs => endMs - startMs;
+}
+
+// One cold start: engine init up to the bootstrap scene, then every bootstrap phase,
+// up to the first frame the player can move in. Written next to the saves, with a
+// one-line summary appended to a CSV so startup time can be tracked across builds.
+[System.Serializable]
+public class StartupReport
+{
+    public string date;
+    public string version;
+    public string platform;
+    public string firstRoom;
+    public double engineInitMs;      // Process start to GameBootstrap.Awake
+    public double firstInteractiveMs; // Process start to the first room's first full frame
+    public List<StartupPhase> phases = new List<StartupPhase>();
+
+    public const string HistoryFileName = "startup_history.csv";
+
+    public static double NowMs => Time.realtimeSinceStartupAsDouble * 1000.0;
+
+    public StartupPhase AddPhase(string name, string[] dependsOn)
+    {
+        StartupPhase phase = new StartupPhase
+        {
+            name = name,
+            dependsOn = string.Join(",", dependsOn),
+            startMs = NowMs
+        };
+        phases.Add(phase);
+        return phase;
+    }
+
+    public void Write(string fileName)
+    {
+        date = System.DateTime.Now.ToString("yyyy-MM-dd HH:mm:ss");
+        version = Application.version;
+        platform = Application.platform.ToString();
+
+        try
+        {
+            File.WriteAllText(Path.Combine(Application.persistentDataPath, fileName), JsonUtility.ToJson(this, true));
+
+            string historyPath = Path.Combine(Application.persistentDataPath, HistoryFileName);
+            if (!File.Exists(historyPath))
+                File.WriteAllText(historyPath, "date,version,platform,firstRoom,engineInitMs,firstInteractiveMs\n");
+            File.AppendAllText(historyPath, $"{date},{version},{platform},{firstRoom},{engineInitMs:F1},{firstInteractiveMs:F1}\n");
+        }
+        catch (System.Exception e)
+        {
+            Debug.LogWarning($"[StartupReport] Failed to write report: {e.Message}");
+        }
+    }
+
+    public override string ToString()
+    {
+        System.Text.StringBuilder report = new System.Text.StringBuilder();
+        report.Append($"[StartupReport] {firstRoom} interactive at {firstInteractiveMs:F0} ms (engine init {engineInitMs:F0} ms)");
+
+        foreach (StartupPhase phase in phases)
+        {
+            report.Append($"\n  {phase.name,-16} {phase.startMs,8:F1} -> {phase.endMs,8:F1} ms ({phase.DurationMs:F1} ms){(phase.failed ? " FAILED" : "")}");
+            if (!string.IsNullOrEmpty(phase.dependsOn))
+                report.Append($"  after {phase.dependsOn}");
+        }
+
+        return report.ToString();
+    }
+}
@@ -0,0 +1,8 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+// Container for one scene's baked chunk meshes and materials (written by TilemapChunkBaker)
+public class TileChunkAsset : ScriptableObject
+{
+    public List<Mesh> meshes = new List<Mesh>();
+}
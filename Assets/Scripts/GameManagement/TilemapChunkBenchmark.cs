@@ -0,0 +1,31 @@
+using UnityEngine;
+using UnityEngine.SceneManagement;
+using System.Collections;
+
+// Per-room before/after for the baked tile chunks: TilemapRenderers vs chunk meshes
+public class TilemapChunkBenchmark : BakeComparison<TilemapChunkRoot, RenderStatsRecorder.Result>
+{
+    protected override string BakeMenu => "Tools/Rooms/Bake Tilemap Chunks";
+
+    protected override IEnumerator Sample(bool baked, System.Action<RenderStatsRecorder.Result> onDone)
+    {
+        return SampleRenderStats(null, null, onDone);
+    }
+
+    protected override string BuildReport()
+    {
+        int layers = TilemapChunkRoot.Active.Count;
+        int chunks = 0;
+        int visible = 0;
+
+        foreach (TilemapChunkRoot root in TilemapChunkRoot.Active)
+        {
+            chunks += root.chunks.Count;
+            visible += root.VisibleChunkCount;
+        }
+
+        return $"[TilemapChunkBenchmark] {SceneManager.GetActiveScene().name}: {layers} layers, {chunks} chunks ({visible} visible)\n" +
+               $"  Before (TilemapRenderer): {Before}\n" +
+               $"  After  (chunk meshes):    {After}";
+    }
+}
@@ -0,0 +1,98 @@
+using UnityEngine;
+using UnityEngine.Rendering;
+using UnityEngine.Tilemaps;
+using System.Collections.Generic;
+
+[System.Serializable]
+public class TileChunk
+{
+    public Vector2Int coord;
+    public MeshRenderer renderer;
+    public Bounds bounds; // World space, baked
+    public int tileCount;
+}
+
+// Baked static meshes for one Tilemap layer (see TilemapChunkBaker). The source
+// TilemapRenderer stays in the scene for authoring but is disabled; chunks outside
+// the CameraFollow view are switched off before the camera culls.
+public class TilemapChunkRoot : BakedToggle<TilemapChunkRoot>
+{
+    [Header("Source")]
+    public Tilemap sourceTilemap;
+    public TilemapRenderer sourceRenderer;
+    public int chunkSize = 16;
+
+    [Header("Chunks")]
+    public List<TileChunk> chunks = new List<TileChunk>();
+
+    [Header("Culling")]
+    public bool cullChunks = true;
+    public float cullMargin = 1f; // World units beyond the view edge
+
+    private Camera mainCamera;
+
+    public int VisibleChunkCount { get; private set; }
+
+    protected override void OnEnable()
+    {
+        base.OnEnable();
+        RenderPipelineManager.beginCameraRendering += OnBeginCameraRendering;
+    }
+
+    protected override void OnDisable()
+    {
+        base.OnDisable();
+        RenderPipelineManager.beginCameraRendering -= OnBeginCameraRendering;
+    }
+
+    // Runs after CameraFollow.LateUpdate has placed the camera and before URP culls
+    void OnBeginCameraRendering(ScriptableRenderContext context, Camera camera)
+    {
+        if (mainCamera == null)
+            mainCamera = Camera.main;
+
+        if (camera != mainCamera || !BakedEnabled || !cullChunks) return;
+
+        float halfHeight = camera.orthographicSize + cullMargin;
+        float halfWidth = camera.orthographicSize * camera.aspect + cullMargin;
+        Vector3 center = camera.transform.position;
+        Bounds view = new Bounds(new Vector3(center.x, center.y, 0f), new Vector3(halfWidth * 2f, halfHeight * 2f, float.MaxValue));
+
+        int visible = 0;
+        foreach (TileChunk chunk in chunks)
+        {
+            if (chunk.renderer == null) continue;
+
+            bool isVisible = chunk.bounds.Intersects(view);
+            if (chunk.renderer.enabled != isVisible)
+                chunk.renderer.enabled = isVisible;
+
+            if (isVisible)
+                visible++;
+        }
+
+        VisibleChunkCount = visible;
+    }
+
+    // true = baked chunk meshes, false = the original TilemapRenderer
+    protected override void ApplyBaked(bool enabled)
+    {
+        foreach (TileChunk chunk in chunks)
+        {
+            if (chunk.renderer != null)
+                chunk.renderer.enabled = enabled;
+        }
+
+        if (sourceRenderer != null)
+            sourceRenderer.enabled = !enabled;
+    }
+
+    void OnDrawGizmosSelected()
+    {
+        foreach (TileChunk chunk in chunks)
+        {
+            Gizmos.color = chunk.renderer != null && chunk.renderer.enabled ? Color.green : Color.gray;
+            Gizmos.DrawWireCube(chunk.bounds.center, chunk.bounds.size);
+        }
+    }
+}
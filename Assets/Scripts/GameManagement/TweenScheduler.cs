@@ -0,0 +1,451 @@
+using UnityEngine;
+using UnityEngine.UI;
+
+public enum TweenTrack
+{
+    Delay,
+    Position,
+    Scale,
+    GraphicColor,
+    SpriteColor,
+    GraphicAlpha,
+    SpriteAlpha
+}
+
+public enum TweenEase
+{
+    Linear,
+    InQuad,
+    OutQuad,
+    InOutQuad,
+    OutCubic
+}
+
+// Completion callback. The owner implements it and switches on the tag, so scheduling
+// a tween never allocates a delegate or closure.
+public interface ITweenCallback
+{
+    void OnTweenComplete(int tag);
+}
+
+// Identifies a scheduled tween; goes stale once the slot is reused
+public readonly struct TweenHandle
+{
+    public readonly int slot; // 1-based so default(TweenHandle) is never valid
+    public readonly int version;
+
+    public TweenHandle(int slot, int version)
+    {
+        this.slot = slot;
+        this.version = version;
+    }
+
+    public bool IsValid => slot > 0;
+}
+
+// Small UI/pickup animations as plain structs in a preallocated slot array, ticked once
+// per frame, instead of one coroutine (enumerator + yield instructions) per animation.
+// Tweens can be chained into sequences with Then(); a chained tween captures its start
+// value when it begins, not when it was scheduled. Persistent, so delays started right
+// before a scene load still fire.
+public class TweenScheduler : PersistentSingleton<TweenScheduler>
+{
+    [Header("Capacity")]
+    public int initialCapacity = 64; // Doubles (with a warning) if ever exceeded
+
+    struct Tween
+    {
+        public bool active;
+        public bool waiting; // Queued behind another tween in a sequence
+        public bool started; // Start value captured
+        public bool unscaled;
+        public int version;
+        public int startFrame;
+        public int next;     // Slot index started when this one finishes, -1 for none
+
+        public TweenTrack track;
+        public TweenEase ease;
+        public float duration;
+        public float elapsed;
+        public Vector4 from;
+        public Vector4 to;
+
+        public Transform transform;
+        public Graphic graphic;
+        public SpriteRenderer sprite;
+
+        public ITweenCallback callback;
+        public int tag;
+    }
+
+    private Tween[] tweens;
+    private int[] freeSlots;
+    private int freeCount;
+    private int highWater; // Slots at or above this index have never been used
+    private int activeCount;
+    private int peakCount;
+
+    public int ActiveCount => activeCount;
+
+    protected override void OnSingletonAwake()
+    {
+        Allocate(Mathf.Max(8, initialCapacity));
+    }
+
+    void Allocate(int capacity)
+    {
+        Tween[] grown = new Tween[capacity];
+        int[] grownFree = new int[capacity];
+
+        if (tweens != null)
+        {
+            System.Array.Copy(tweens, grown, tweens.Length);
+            System.Array.Copy(freeSlots, grownFree, freeCount);
+        }
+
+        tweens = grown;
+        freeSlots = grownFree;
+    }
+
+    // Scheduling
+
+    public TweenHandle Delay(float duration, bool unscaled = false)
+    {
+        int slot = Acquire(TweenTrack.Delay, duration, TweenEase.Linear, unscaled);
+        return Handle(slot);
+    }
+
+    public TweenHandle Move(Transform target, Vector3 to, float duration, TweenEase ease = TweenEase.Linear, bool unscaled = false)
+    {
+        if (target == null) return default;
+
+        int slot = Acquire(TweenTrack.Position, duration, ease, unscaled);
+        tweens[slot].transform = target;
+        tweens[slot].to = to;
+        return Handle(slot);
+    }
+
+    public TweenHandle Scale(Transform target, Vector3 to, float duration, TweenEase ease = TweenEase.Linear, bool unscaled = false)
+    {
+        if (target == null) return default;
+
+        int slot = Acquire(TweenTrack.Scale, duration, ease, unscaled);
+        tweens[slot].transform = target;
+        tweens[slot].to = to;
+        return Handle(slot);
+    }
+
+    public TweenHandle Color(Graphic target, Color to, float duration, TweenEase ease = TweenEase.Linear, bool unscaled = false)
+    {
+        if (target == null) return default;
+
+        int slot = Acquire(TweenTrack.GraphicColor, duration, ease, unscaled);
+        tweens[slot].graphic = target;
+        tweens[slot].to = to;
+        return Handle(slot);
+    }
+
+    public TweenHandle Color(SpriteRenderer target, Color to, float duration, TweenEase ease = TweenEase.Linear, bool unscaled = false)
+    {
+        if (target == null) return default;
+
+        int slot = Acquire(TweenTrack.SpriteColor, duration, ease, unscaled);
+        tweens[slot].sprite = target;
+        tweens[slot].to = to;
+        return Handle(slot);
+    }
+
+    public TweenHandle Alpha(Graphic target, float to, float duration, TweenEase ease = TweenEase.Linear, bool unscaled = false)
+    {
+        if (target == null) return default;
+
+        int slot = Acquire(TweenTrack.GraphicAlpha, duration, ease, unscaled);
+        tweens[slot].graphic = target;
+        tweens[slot].to.x = to;
+        return Handle(slot);
+    }
+
+    public TweenHandle Alpha(SpriteRenderer target, float to, float duration, TweenEase ease = TweenEase.Linear, bool unscaled = false)
+    {
+        if (target == null) return default;
+
+        int slot = Acquire(TweenTrack.SpriteAlpha, duration, ease, unscaled);
+        tweens[slot].sprite = target;
+        tweens[slot].to.x = to;
+        return Handle(slot);
+    }
+
+    // Called with tag when the tween finishes; not called if it's killed
+    public TweenHandle OnComplete(TweenHandle handle, ITweenCallback callback, int tag = 0)
+    {
+        if (TryGetSlot(handle, out int slot))
+        {
+            tweens[slot].callback = callback;
+            tweens[slot].tag = tag;
+        }
+        return handle;
+    }
+
+    // Holds second until first finishes; returns second so sequences read left to right
+    public TweenHandle Then(TweenHandle first, TweenHandle second)
+    {
+        if (!TryGetSlot(second, out int secondSlot)) return second;
+
+        if (!TryGetSlot(first, out int firstSlot))
+            return second; // First already done or killed: second just runs
+
+        // Append after anything already chained to first
+        while (tweens[firstSlot].next >= 0)
+            firstSlot = tweens[firstSlot].next;
+
+        tweens[firstSlot].next = secondSlot;
+        tweens[secondSlot].waiting = true;
+        return second;
+    }
+
+    public bool IsActive(TweenHandle handle)
+    {
+        return TryGetSlot(handle, out _);
+    }
+
+    // Stops the tween where it is, along with anything chained after it
+    public void Kill(TweenHandle handle)
+    {
+        if (TryGetSlot(handle, out int slot))
+            ReleaseChain(slot);
+    }
+
+    // Stops every tween animating target (a Transform, Graphic or SpriteRenderer)
+    public void KillAll(Object target)
+    {
+        if (target == null) return;
+
+        for (int i = 0; i < highWater; i++)
+        {
+            if (!tweens[i].active) continue;
+
+            if (tweens[i].transform == target || tweens[i].graphic == target || tweens[i].sprite == target)
+                ReleaseChain(i);
+        }
+    }
+
+    // Slots
+
+    int Acquire(TweenTrack track, float duration, TweenEase ease, bool unscaled)
+    {
+        int slot;
+        if (freeCount > 0)
+        {
+            slot = freeSlots[--freeCount];
+        }
+        else
+        {
+            if (highWater == tweens.Length)
+            {
+                Debug.LogWarning($"[TweenScheduler] {tweens.Length} tweens active - growing pool, raise initialCapacity");
+                Allocate(tweens.Length * 2);
+            }
+            slot = highWater++;
+        }
+
+        int version = tweens[slot].version + 1;
+        tweens[slot] = new Tween
+        {
+            active = true,
+            version = version,
+            startFrame = Time.frameCount,
+            next = -1,
+            track = track,
+            ease = ease,
+            duration = duration,
+            unscaled = unscaled
+        };
+
+        activeCount++;
+        peakCount = Mathf.Max(peakCount, activeCount);
+        return slot;
+    }
+
+    TweenHandle Handle(int slot)
+    {
+        return new TweenHandle(slot + 1, tweens[slot].version);
+    }
+
+    bool TryGetSlot(TweenHandle handle, out int slot)
+    {
+        slot = handle.slot - 1;
+        return slot >= 0 && slot < highWater && tweens[slot].active && tweens[slot].version == handle.version;
+    }
+
+    void Release(int slot)
+    {
+        // Drop object references so a dead target isn't kept alive by a free slot
+        int version = tweens[slot].version;
+        tweens[slot] = new Tween { version = version, next = -1 };
+
+        freeSlots[freeCount++] = slot;
+        activeCount--;
+    }
+
+    void ReleaseChain(int slot)
+    {
+        // Killed mid-sequence: whatever it was waiting on must not start a reused slot
+        if (tweens[slot].waiting)
+        {
+            for (int i = 0; i < highWater; i++)
+            {
+                if (tweens[i].active && tweens[i].next == slot)
+                    tweens[i].next = -1;
+            }
+        }
+
+        while (slot >= 0)
+        {
+            int next = tweens[slot].next;
+            Release(slot);
+            slot = next;
+        }
+    }
+
+    // Ticking
+
+    void Update()
+    {
+        if (activeCount == 0) return;
+
+        int frame = Time.frameCount;
+        float deltaTime = Time.deltaTime;
+        float unscaledDeltaTime = Time.unscaledDeltaTime;
+
+        for (int i = 0; i < highWater; i++)
+        {
+            // Tweens begin the frame after they're scheduled, like a coroutine's first yield
+            if (!tweens[i].active || tweens[i].waiting || tweens[i].startFrame == frame) continue;
+
+            ref Tween tween = ref tweens[i];
+
+            if (!HasTarget(ref tween))
+            {
+                ReleaseChain(i);
+                continue;
+            }
+
+            if (!tween.started)
+            {
+                tween.from = Capture(ref tween);
+                tween.started = true;
+            }
+
+            tween.elapsed += tween.unscaled ? unscaledDeltaTime : deltaTime;
+            float t = tween.duration > 0f ? Mathf.Clamp01(tween.elapsed / tween.duration) : 1f;
+            Apply(ref tween, Evaluate(tween.ease, t));
+
+            if (t >= 1f)
+                Finish(i, frame);
+        }
+    }
+
+    void Finish(int slot, int frame)
+    {
+        ITweenCallback callback = tweens[slot].callback;
+        int tag = tweens[slot].tag;
+        int next = tweens[slot].next;
+
+        Release(slot);
+
+        // Next in the sequence picks up on the following frame
+        if (next >= 0)
+        {
+            tweens[next].waiting = false;
+            tweens[next].startFrame = frame;
+        }
+
+        // Released first, so the callback can schedule into this slot
+        if (callback != null && !(callback is Object owner && owner == null))
+            callback.OnTweenComplete(tag);
+    }
+
+    static bool HasTarget(ref Tween tween)
+    {
+        switch (tween.track)
+        {
+            case TweenTrack.Position:
+            case TweenTrack.Scale:
+                return tween.transform != null;
+            case TweenTrack.GraphicColor:
+            case TweenTrack.GraphicAlpha:
+                return tween.graphic != null;
+            case TweenTrack.SpriteColor:
+            case TweenTrack.SpriteAlpha:
+                return tween.sprite != null;
+            default:
+                // A delay lives as long as whoever is waiting on it
+                return !(tween.callback is Object owner && owner == null);
+        }
+    }
+
+    static Vector4 Capture(ref Tween tween)
+    {
+        switch (tween.track)
+        {
+            case TweenTrack.Position: return tween.transform.position;
+            case TweenTrack.Scale: return tween.transform.localScale;
+            case TweenTrack.GraphicColor: return tween.graphic.color;
+            case TweenTrack.SpriteColor: return tween.sprite.color;
+            case TweenTrack.GraphicAlpha: return new Vector4(tween.graphic.color.a, 0f, 0f, 0f);
+            case TweenTrack.SpriteAlpha: return new Vector4(tween.sprite.color.a, 0f, 0f, 0f);
+            default: return Vector4.zero;
+        }
+    }
+
+    static void Apply(ref Tween tween, float t)
+    {
+        switch (tween.track)
+        {
+            case TweenTrack.Position:
+                tween.transform.position = Vector4.LerpUnclamped(tween.from, tween.to, t);
+                break;
+            case TweenTrack.Scale:
+                tween.transform.localScale = Vector4.LerpUnclamped(tween.from, tween.to, t);
+                break;
+            case TweenTrack.GraphicColor:
+                tween.graphic.color = Vector4.LerpUnclamped(tween.from, tween.to, t);
+                break;
+            case TweenTrack.SpriteColor:
+                tween.sprite.color = Vector4.LerpUnclamped(tween.from, tween.to, t);
+                break;
+            case TweenTrack.GraphicAlpha:
+            {
+                Color color = tween.graphic.color;
+                color.a = Mathf.LerpUnclamped(tween.from.x, tween.to.x, t);
+                tween.graphic.color = color;
+                break;
+            }
+            case TweenTrack.SpriteAlpha:
+            {
+                Color color = tween.sprite.color;
+                color.a = Mathf.LerpUnclamped(tween.from.x, tween.to.x, t);
+                tween.sprite.color = color;
+                break;
+            }
+        }
+    }
+
+    public static float Evaluate(TweenEase ease, float t)
+    {
+        switch (ease)
+        {
+            case TweenEase.InQuad: return t * t;
+            case TweenEase.OutQuad: return 1f - (1f - t) * (1f - t);
+            case TweenEase.InOutQuad: return t < 0.5f ? 2f * t * t : 1f - 2f * (1f - t) * (1f - t);
+            case TweenEase.OutCubic: return 1f - (1f - t) * (1f - t) * (1f - t);
+            default: return t;
+        }
+    }
+
+    [ContextMenu("Log Tweens")]
+    void LogTweens()
+    {
+        Debug.Log($"[TweenScheduler] {activeCount} active, peak {peakCount}, capacity {tweens.Length}");
+    }
+}
@@ -0,0 +1,195 @@
+using UnityEngine;
+using UnityEngine.UI;
+using Unity.Profiling;
+using System.Collections.Generic;
+using System.Reflection;
+
+// Per-canvas UI rebuild counts: graphics (TMP text included) and layout passes queued
+// with CanvasUpdateRegistry each frame, plus the frame's canvas update and batch build
+// time. A canvas that shows up every frame re-batches every frame, so anything static
+// on it belongs on another canvas. Reads the registry's private queues - dev only.
+[DefaultExecutionOrder(int.MaxValue)]
+public class UIRebuildProfiler : MonoBehaviour
+{
+    [Header("Reporting")]
+    public int reportIntervalFrames = 300; // 0 = only from the context menu
+    public bool logOnlyRebuiltCanvases = true;
+
+    [Header("Markers")]
+    public string canvasUpdateMarker = "Canvas.SendWillRenderCanvases"; // Layout + graphic rebuilds
+    public string batchMarker = "Canvas.BuildBatch";                    // Re-batching dirty canvases
+
+    public class CanvasStats
+    {
+        public Canvas canvas;
+        public string path;
+        public int graphicRebuilds;
+        public int layoutRebuilds;
+        public int dirtyFrames;
+        public int peakGraphics;
+        public int peakLayouts;
+
+        // Per-frame scratch
+        public int frameGraphics;
+        public int frameLayouts;
+    }
+
+    private static readonly FieldInfo layoutQueueField = typeof(CanvasUpdateRegistry).GetField("m_LayoutRebuildQueue", BindingFlags.NonPublic | BindingFlags.Instance);
+    private static readonly FieldInfo graphicQueueField = typeof(CanvasUpdateRegistry).GetField("m_GraphicRebuildQueue", BindingFlags.NonPublic | BindingFlags.Instance);
+
+    private IList<ICanvasElement> layoutQueue;
+    private IList<ICanvasElement> graphicQueue;
+
+    private readonly Dictionary<Canvas, CanvasStats> stats = new Dictionary<Canvas, CanvasStats>();
+    private readonly List<CanvasStats> touched = new List<CanvasStats>();
+
+    private ProfilerRecorder updateRecorder;
+    private ProfilerRecorder batchRecorder;
+    private double updateMsTotal;
+    private double batchMsTotal;
+    private int frames;
+
+    public IEnumerable<CanvasStats> Stats => stats.Values;
+
+    void OnEnable()
+    {
+        if (layoutQueueField == null || graphicQueueField == null)
+        {
+            Debug.LogWarning("[UIRebuildProfiler] CanvasUpdateRegistry queues not found in this UGUI version - disabling");
+            enabled = false;
+            return;
+        }
+
+        layoutQueue = layoutQueueField.GetValue(CanvasUpdateRegistry.instance) as IList<ICanvasElement>;
+        graphicQueue = graphicQueueField.GetValue(CanvasUpdateRegistry.instance) as IList<ICanvasElement>;
+
+        updateRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Gui, canvasUpdateMarker);
+        batchRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Gui, batchMarker);
+    }
+
+    void OnDisable()
+    {
+        updateRecorder.Dispose();
+        batchRecorder.Dispose();
+    }
+
+    // Last LateUpdate of the frame: everything dirtied in Update/LateUpdate/coroutines is
+    // queued, and PostLateUpdate hasn't processed the queues yet
+    void LateUpdate()
+    {
+        if (layoutQueue == null || graphicQueue == null) return;
+
+        // Markers report the previous frame's canvas work
+        if (updateRecorder.Valid)
+            updateMsTotal += updateRecorder.LastValue * 1e-6;
+        if (batchRecorder.Valid)
+            batchMsTotal += batchRecorder.LastValue * 1e-6;
+
+        touched.Clear();
+
+        for (int i = 0; i < graphicQueue.Count; i++)
+        {
+            CanvasStats canvasStats = GetStats(graphicQueue[i]);
+            if (canvasStats != null)
+                canvasStats.frameGraphics++;
+        }
+
+        for (int i = 0; i < layoutQueue.Count; i++)
+        {
+            CanvasStats canvasStats = GetStats(layoutQueue[i]);
+            if (canvasStats != null)
+                canvasStats.frameLayouts++;
+        }
+
+        foreach (CanvasStats canvasStats in touched)
+        {
+            canvasStats.graphicRebuilds += canvasStats.frameGraphics;
+            canvasStats.layoutRebuilds += canvasStats.frameLayouts;
+            canvasStats.peakGraphics = Mathf.Max(canvasStats.peakGraphics, canvasStats.frameGraphics);
+            canvasStats.peakLayouts = Mathf.Max(canvasStats.peakLayouts, canvasStats.frameLayouts);
+            canvasStats.dirtyFrames++;
+            canvasStats.frameGraphics = 0;
+            canvasStats.frameLayouts = 0;
+        }
+
+        frames++;
+
+        if (reportIntervalFrames > 0 && frames >= reportIntervalFrames)
+        {
+            LogReport();
+            ResetStats();
+        }
+    }
+
+    CanvasStats GetStats(ICanvasElement element)
+    {
+        if (element == null || element.IsDestroyed()) return null;
+
+        // Nearest canvas, nested ones included - that's the one that re-batches
+        Canvas canvas = element is Graphic graphic ? graphic.canvas : null;
+        if (canvas == null && element.transform != null)
+            canvas = element.transform.GetComponentInParent<Canvas>();
+        if (canvas == null) return null;
+
+        if (!stats.TryGetValue(canvas, out CanvasStats canvasStats))
+        {
+            canvasStats = new CanvasStats { canvas = canvas, path = GetPath(canvas.transform) };
+            stats.Add(canvas, canvasStats);
+        }
+
+        if (canvasStats.frameGraphics == 0 && canvasStats.frameLayouts == 0)
+            touched.Add(canvasStats);
+
+        return canvasStats;
+    }
+
+    static string GetPath(Transform target)
+    {
+        string path = target.name;
+        while (target.parent != null)
+        {
+            target = target.parent;
+            path = target.name + "/" + path;
+        }
+        return path;
+    }
+
+    [ContextMenu("Log Report")]
+    public void LogReport()
+    {
+        int frameCount = Mathf.Max(1, frames);
+
+        System.Text.StringBuilder report = new System.Text.StringBuilder();
+        string updateTime = updateRecorder.Valid ? $"{updateMsTotal / frameCount:F3} ms" : "n/a";
+        string batchTime = batchRecorder.Valid ? $"{batchMsTotal / frameCount:F3} ms" : "n/a";
+        report.Append($"[UIRebuildProfiler] {frames} frames, canvas update {updateTime}/frame, batch build {batchTime}/frame");
+
+        foreach (CanvasStats canvasStats in stats.Values)
+        {
+            if (logOnlyRebuiltCanvases && canvasStats.dirtyFrames == 0) continue;
+
+            report.Append($"\n  {canvasStats.path}: dirty {100f * canvasStats.dirtyFrames / frameCount:F0}% of frames, " +
+                          $"graphics {(float)canvasStats.graphicRebuilds / frameCount:F2}/frame (peak {canvasStats.peakGraphics}), " +
+                          $"layouts {(float)canvasStats.layoutRebuilds / frameCount:F2}/frame (peak {canvasStats.peakLayouts})");
+        }
+
+        Debug.Log(report.ToString());
+    }
+
+    [ContextMenu("Reset")]
+    public void ResetStats()
+    {
+        foreach (CanvasStats canvasStats in stats.Values)
+        {
+            canvasStats.graphicRebuilds = 0;
+            canvasStats.layoutRebuilds = 0;
+            canvasStats.dirtyFrames = 0;
+            canvasStats.peakGraphics = 0;
+            canvasStats.peakLayouts = 0;
+        }
+
+        updateMsTotal = 0;
+        batchMsTotal = 0;
+        frames = 0;
+    }
+}
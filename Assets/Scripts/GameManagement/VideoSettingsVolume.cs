@@ -0,0 +1,135 @@
+using UnityEngine;
+using UnityEngine.Rendering;
+using UnityEngine.Rendering.Universal;
+using UnityEngine.SceneManagement;
+
+// Brightness/contrast as a global URP ColorAdjustments override on top of
+// DefaultVolumeProfile. The change is folded into the color grading LUT, so it costs
+// nothing per frame beyond the post pass, and the post pass is only turned on while
+// the settings are away from neutral.
+public class VideoSettingsVolume : PersistentSingleton<VideoSettingsVolume>
+{
+    [Header("Ranges")]
+    public float minExposure = -2.3f; // ~20% brightness at slider 0 (old overlay went to 80% black)
+    public float maxExposure = 1f;
+    public float contrastRange = 50f;  // ColorAdjustments.contrast is -100..100
+
+    private Volume volume;
+    private VolumeProfile profile;
+    private ColorAdjustments colorAdjustments;
+    private VolumeComponent[] effectsOff; // Zeroed while the quality tier disallows post effects
+    private float brightness = 0.5f;
+    private float contrast = 0.5f;
+    private bool postProcessingAllowed = true;
+
+    protected override void OnSingletonAwake()
+    {
+        // Runtime profile with the two adjustments; everything else comes from the default profile
+        profile = ScriptableObject.CreateInstance<VolumeProfile>();
+        colorAdjustments = profile.Add<ColorAdjustments>();
+        AddEffectsOff();
+
+        volume = gameObject.AddComponent<Volume>();
+        volume.isGlobal = true;
+        volume.priority = 100f;
+        volume.sharedProfile = profile;
+
+        SceneManager.sceneLoaded += OnSceneLoaded;
+        RoomStreamingManager.OnRoomActivated += OnRoomActivated;
+
+        QualityGovernor.OnQualityChanged += ApplyQuality;
+        if (QualityGovernor.Current != null)
+            ApplyQuality(QualityGovernor.Current);
+    }
+
+    // Overrides that switch off whatever room volumes add on top of the grading
+    void AddEffectsOff()
+    {
+        Bloom bloom = profile.Add<Bloom>();
+        bloom.intensity.Override(0f);
+
+        Vignette vignette = profile.Add<Vignette>();
+        vignette.intensity.Override(0f);
+
+        FilmGrain filmGrain = profile.Add<FilmGrain>();
+        filmGrain.intensity.Override(0f);
+
+        ChromaticAberration chromaticAberration = profile.Add<ChromaticAberration>();
+        chromaticAberration.intensity.Override(0f);
+
+        effectsOff = new VolumeComponent[] { bloom, vignette, filmGrain, chromaticAberration };
+        foreach (VolumeComponent effect in effectsOff)
+            effect.active = !postProcessingAllowed;
+    }
+
+    // The lowest tier drops the post effects but keeps the player's brightness/contrast
+    void ApplyQuality(QualityTier tier)
+    {
+        postProcessingAllowed = tier.postProcessing;
+
+        foreach (VolumeComponent effect in effectsOff)
+            effect.active = !postProcessingAllowed;
+
+        ApplyToCamera();
+    }
+
+    protected override void OnSingletonDestroy()
+    {
+        SceneManager.sceneLoaded -= OnSceneLoaded;
+        RoomStreamingManager.OnRoomActivated -= OnRoomActivated;
+        QualityGovernor.OnQualityChanged -= ApplyQuality;
+
+        if (profile != null)
+            Destroy(profile);
+    }
+
+    void OnSceneLoaded(Scene scene, LoadSceneMode mode)
+    {
+        ApplyToCamera();
+    }
+
+    // A preloaded room was loaded while its camera slept; it only counts once awake
+    void OnRoomActivated(string roomName)
+    {
+        ApplyToCamera();
+    }
+
+    // 0..1 slider, 0.5 is neutral
+    public void SetBrightness(float value)
+    {
+        brightness = value;
+
+        float exposure = value < 0.5f
+            ? Mathf.Lerp(minExposure, 0f, value * 2f)
+            : Mathf.Lerp(0f, maxExposure, (value - 0.5f) * 2f);
+
+        colorAdjustments.postExposure.Override(exposure);
+        colorAdjustments.postExposure.overrideState = !Mathf.Approximately(value, 0.5f);
+
+        ApplyToCamera();
+    }
+
+    // 0..1 slider, 0.5 is neutral
+    public void SetContrast(float value)
+    {
+        contrast = value;
+
+        colorAdjustments.contrast.Override((value - 0.5f) * 2f * contrastRange);
+        colorAdjustments.contrast.overrideState = !Mathf.Approximately(value, 0.5f);
+
+        ApplyToCamera();
+    }
+
+    public bool IsNeutral => Mathf.Approximately(brightness, 0.5f) && Mathf.Approximately(contrast, 0.5f);
+
+    void ApplyToCamera()
+    {
+        Camera mainCamera = Camera.main;
+        if (mainCamera == null) return;
+
+        // Only pay for the post pass when there's something to apply; the grading is a
+        // player setting, so it stays on at every quality tier
+        UniversalAdditionalCameraData cameraData = mainCamera.GetUniversalAdditionalCameraData();
+        cameraData.renderPostProcessing = !IsNeutral;
+    }
+}
@@ -16,7 +16,7 @@ public class AtmosphericLighting : MonoBehaviour
 
     private float baseIntensity;
     private float targetIntensity;
-    private float flickerTimer;
+    private FlickerEntry flickerEntry;
 
     void Start()
     {
@@ -25,25 +25,35 @@ public class AtmosphericLighting : MonoBehaviour
 
         baseIntensity = characterLight.intensity;
         targetIntensity = baseIntensity;
+
+        // Range stays at its maximum; flicker only changes intensity
+        characterLight.range = baseRange + rangeVariation;
+
+        SetFlickerEnabled(enableFlicker);
     }
 
-    void Update()
+    public void SetFlickerEnabled(bool enabled)
     {
-        if (enableFlicker)
+        enableFlicker = enabled;
+
+        if (enabled && flickerEntry == null)
+        {
+            // Create natural candle-like flicker, batched in FlickerSystem
+            flickerEntry = FlickerSystem.Instance?.Register(characterLight, baseIntensity, flickerAmount, flickerSpeed);
+        }
+        else if (!enabled && flickerEntry != null)
         {
-            ApplyFlickerEffect();
+            if (FlickerSystem.HasInstance)
+                FlickerSystem.Instance.Unregister(flickerEntry);
+
+            flickerEntry = null;
+            characterLight.intensity = baseIntensity;
         }
     }
 
-    void ApplyFlickerEffect()
+    void OnDestroy()
     {
-        flickerTimer += Time.deltaTime * flickerSpeed;
-
-        // Create natural candle-like flicker
-        float flicker = Mathf.PerlinNoise(flickerTimer, 0) * flickerAmount;
-        float rangeFlicker = Mathf.PerlinNoise(flickerTimer * 0.5f, 100) * rangeVariation;
-
-        characterLight.intensity = baseIntensity + flicker;
-        characterLight.range = baseRange + rangeFlicker;
+        if (flickerEntry != null && FlickerSystem.HasInstance)
+            FlickerSystem.Instance.Unregister(flickerEntry);
     }
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+using UnityEngine;
+using UnityEditor;
+using System.Collections.Generic;
+using System.IO;
+
+// Bakes Lisa_Idle_* / Lisa_Walk_* style sprite clips into a SpriteFlipbook asset
+public static class SpriteFlipbookBaker
+{
+    [MenuItem("Assets/Bake Sprite Flipbook From Clips", true)]
+    static bool ValidateBakeSelected()
+    {
+        foreach (Object obj in Selection.objects)
+        {
+            if (obj is AnimationClip) return true;
+        }
+        return false;
+    }
+
+    [MenuItem("Assets/Bake Sprite Flipbook From Clips")]
+    static void BakeSelected()
+    {
+        List<AnimationClip> clips = new List<AnimationClip>();
+        foreach (Object obj in Selection.objects)
+        {
+            if (obj is AnimationClip clip)
+                clips.Add(clip);
+        }
+
+        string firstPath = AssetDatabase.GetAssetPath(clips[0]);
+        string folder = Path.GetDirectoryName(firstPath);
+        string characterName = clips[0].name.Split('_')[0];
+        string assetPath = Path.Combine(folder, $"{characterName}_Flipbook.asset").Replace('\\', '/');
+
+        SpriteFlipbook flipbook = AssetDatabase.LoadAssetAtPath<SpriteFlipbook>(assetPath);
+        if (flipbook == null)
+        {
+            flipbook = ScriptableObject.CreateInstance<SpriteFlipbook>();
+            AssetDatabase.CreateAsset(flipbook, assetPath);
+        }
+
+        Bake(flipbook, clips);
+
+        EditorUtility.SetDirty(flipbook);
+        AssetDatabase.SaveAssets();
+        Selection.activeObject = flipbook;
+
+        Debug.Log($"Baked {clips.Count} clips into {assetPath}");
+    }
+
+    public static void Bake(SpriteFlipbook flipbook, List<AnimationClip> clips)
+    {
+        flipbook.idleClips = new FlipbookClip[SpriteFlipbook.DirectionCount];
+        flipbook.walkClips = new FlipbookClip[SpriteFlipbook.DirectionCount];
+
+        foreach (AnimationClip clip in clips)
+        {
+            FlipbookClip baked = BakeClip(clip);
+            if (baked == null)
+            {
+                Debug.LogWarning($"Clip {clip.name} has no sprite curve, skipping");
+                continue;
+            }
+
+            bool isWalking = clip.name.ToLower().Contains("walk");
+            FlipbookDirection direction = GetDirectionFromName(clip.name);
+            FlipbookClip[] target = isWalking ? flipbook.walkClips : flipbook.idleClips;
+            target[(int)direction] = baked;
+        }
+    }
+
+    static FlipbookClip BakeClip(AnimationClip clip)
+    {
+        foreach (EditorCurveBinding binding in AnimationUtility.GetObjectReferenceCurveBindings(clip))
+        {
+            if (binding.type != typeof(SpriteRenderer) || binding.propertyName != "m_Sprite") continue;
+
+            ObjectReferenceKeyframe[] keys = AnimationUtility.GetObjectReferenceCurve(clip, binding);
+            FlipbookClip baked = new FlipbookClip
+            {
+                clipName = clip.name,
+                frames = new Sprite[keys.Length],
+                frameTimes = new float[keys.Length],
+                // Last key is held for one sample, matching the clip's stop time
+                length = keys.Length > 0 ? keys[keys.Length - 1].time + 1f / clip.frameRate : 0f
+            };
+
+            for (int i = 0; i < keys.Length; i++)
+            {
+                baked.frames[i] = keys[i].value as Sprite;
+                baked.frameTimes[i] = keys[i].time;
+            }
+
+            return baked;
+        }
+
+        return null;
+    }
+
+    // Walk clips are named LeftDown/RightDown, so check left/right before up/down
+    static FlipbookDirection GetDirectionFromName(string clipName)
+    {
+        string lower = clipName.ToLower();
+
+        if (lower.Contains("left")) return FlipbookDirection.Left;
+        if (lower.Contains("right")) return FlipbookDirection.Right;
+        if (lower.Contains("up")) return FlipbookDirection.Up;
+        return FlipbookDirection.Down;
+    }
+}
@@ -5,11 +5,13 @@ public class JoystickPlayerController : MonoBehaviour
     [Header("Movement")]
     public float moveSpeed = 5f;
     public bool usePhysics = true;
+    public bool useInterpolation = true; // Smooths rendering between fixed simulation ticks
 
     [Header("Components")]
     private Rigidbody2D rb;
     private Animator animator;
     private SpriteRenderer spriteRenderer;
+    private SpriteFlipbookAnimator flipbookAnimator;
 
     [Header("Joystick Reference")]
     public VirtualJoystick joystick;
@@ -19,14 +21,40 @@ public class JoystickPlayerController : MonoBehaviour
     // Store last direction for idle animations
     private Vector2 lastDirection = Vector2.down; // Start facing down
 
+    // Cardinal direction computed once per frame in HandleMovement
+    private Vector2 cardinalDirection = Vector2.zero;
+    private bool isMoving = false;
+
+    // Animator parameter IDs (avoids string hashing every frame)
+    private static readonly int IsWalkingHash = Animator.StringToHash("isWalking");
+    private static readonly int InputXHash = Animator.StringToHash("InputX");
+    private static readonly int InputYHash = Animator.StringToHash("InputY");
+
     void Start()
     {
         // Get components
         rb = GetComponent<Rigidbody2D>();
         animator = GetComponent<Animator>();
         spriteRenderer = GetComponent<SpriteRenderer>();
+        flipbookAnimator = GetComponent<SpriteFlipbookAnimator>();
+
+        // Velocity is applied on the fixed tick and rendered interpolated
+        if (rb != null)
+        {
+            if (useInterpolation)
+                rb.interpolation = RigidbodyInterpolation2D.Interpolate;
+
+            SimulationTickManager.Instance?.Register(rb);
+        }
+
+        // Don't let the Animator fight the flipbook over the sprite
+        if (flipbookAnimator != null && animator != null)
+            animator.enabled = false;
 
         // Find joystick if not assigned
+        if (joystick == null && RoomContext.Current != null)
+            joystick = RoomContext.Current.joystick;
+
         if (joystick == null)
             joystick = FindFirstObjectByType<VirtualJoystick>();
     }
@@ -37,14 +65,41 @@ public class JoystickPlayerController : MonoBehaviour
         HandleAnimation();
     }
 
+    void FixedUpdate()
+    {
+        if (usePhysics && rb != null)
+        {
+            // Physics-based movement, in phase with the physics step
+            rb.linearVelocity = cardinalDirection * moveSpeed;
+        }
+    }
+
+    void OnDisable()
+    {
+        // Stop sliding while dialogue or menus disable the controller
+        cardinalDirection = Vector2.zero;
+        isMoving = false;
+
+        if (rb != null)
+            rb.linearVelocity = Vector2.zero;
+    }
+
+    void OnDestroy()
+    {
+        if (rb != null && SimulationTickManager.HasInstance)
+        {
+            SimulationTickManager.Instance.Unregister(rb);
+        }
+    }
+
     void HandleMovement()
     {
         // Get input from joystick
         Vector2 moveDirection = joystick.Direction();
 
         // Convert to 4-directional movement for actual movement too
-        Vector2 cardinalDirection = Vector2.zero;
-        bool isMoving = moveDirection.magnitude > 0.1f;
+        cardinalDirection = Vector2.zero;
+        isMoving = moveDirection.magnitude > 0.1f;
 
         if (isMoving)
         {
@@ -60,14 +115,9 @@ public class JoystickPlayerController : MonoBehaviour
             }
         }
 
-        if (usePhysics && rb != null)
-        {
-            // Physics-based movement
-            rb.linearVelocity = cardinalDirection * moveSpeed;
-        }
-        else
+        if (!usePhysics || rb == null)
         {
-            // Transform-based movement
+            // Transform-based movement (physics-based movement is applied in FixedUpdate)
             Vector3 movement = new Vector3(cardinalDirection.x, cardinalDirection.y, 0) * moveSpeed * Time.deltaTime;
             transform.Translate(movement);
         }
@@ -75,36 +125,26 @@ public class JoystickPlayerController : MonoBehaviour
 
     void HandleAnimation()
     {
-        if (animator == null) return;
-
-        Vector2 moveDirection = joystick.Direction();
-        bool isMoving = moveDirection.magnitude > 0.1f;
-
-        Vector2 cardinalDirection = Vector2.zero;
-
         if (isMoving)
         {
-            // Convert to 4-directional movement (no diagonals)
-            if (Mathf.Abs(moveDirection.x) > Mathf.Abs(moveDirection.y))
-            {
-                // More horizontal movement
-                cardinalDirection = moveDirection.x > 0 ? Vector2.right : Vector2.left;
-            }
-            else
-            {
-                // More vertical movement  
-                cardinalDirection = moveDirection.y > 0 ? Vector2.up : Vector2.down;
-            }
-
             lastDirection = cardinalDirection;
         }
 
         // Use current cardinal direction or last direction when idle
         Vector2 animDirection = isMoving ? cardinalDirection : lastDirection;
 
-        animator.SetBool("isWalking", isMoving);
-        animator.SetFloat("InputX", animDirection.x);
-        animator.SetFloat("InputY", animDirection.y);
+        // Flipbook characters skip the Animator state machine entirely
+        if (flipbookAnimator != null)
+        {
+            flipbookAnimator.SetState(SpriteFlipbook.ToDirection(animDirection), isMoving);
+            return;
+        }
+
+        if (animator == null) return;
+
+        animator.SetBool(IsWalkingHash, isMoving);
+        animator.SetFloat(InputXHash, animDirection.x);
+        animator.SetFloat(InputYHash, animDirection.y);
 
         /* Handle sprite flipping
         if (animDirection.x > 0.1f)
@@ -12,11 +12,12 @@ public class PlayerLighting : MonoBehaviour
     public float flickerSpeed = 3f;
     public float radiusVariation = 0.5f;
     public float intensityVariation = 0.3f;
+    public bool useFalloffFlicker = true; // Radius flicker is faked through falloff, never by resizing the light
 
     public Light2D playerLight;
-    private float flickerTimer;
+    private FlickerEntry flickerEntry;
 
-    void Start()
+    void Awake()
     {
         if (playerLight == null)
         {
@@ -30,28 +31,33 @@ public class PlayerLighting : MonoBehaviour
         ConfigureLight();
     }
 
-    void ConfigureLight()
+    // Registered only while enabled, so a sleeping room's candle leaves the budget and the flicker batch
+    void OnEnable()
     {
-        playerLight.lightType = Light2D.LightType.Point;
-        playerLight.pointLightOuterRadius = baseRadius;
-        playerLight.intensity = baseIntensity;
-        playerLight.color = lightColor;
-        playerLight.falloffIntensity = 1f; 
-    }
+        // The candle is never culled by the light budget
+        LightingOptimizer.Register(playerLight, true, true);
 
-    void Update()
-    {
-        ApplyFlickerEffect();
+        // Batched with every other flickering light in the room
+        float falloffVariation = useFalloffFlicker ? radiusVariation / (baseRadius + radiusVariation) : 0f;
+        flickerEntry = FlickerSystem.Instance?.Register(playerLight, baseIntensity, intensityVariation, flickerSpeed * 1.5f, falloffVariation);
     }
 
-    void ApplyFlickerEffect()
+    void OnDisable()
     {
-        flickerTimer += Time.deltaTime * flickerSpeed;
+        if (FlickerSystem.HasInstance)
+            FlickerSystem.Instance.Unregister(flickerEntry);
+        flickerEntry = null;
 
-        float radiusFlicker = Mathf.PerlinNoise(flickerTimer, 0) * radiusVariation;
-        float intensityFlicker = Mathf.PerlinNoise(flickerTimer * 1.5f, 100) * intensityVariation;
+        LightingOptimizer.Unregister(playerLight);
+    }
 
-        playerLight.pointLightOuterRadius = baseRadius + radiusFlicker;
-        playerLight.intensity = baseIntensity + intensityFlicker;
+    void ConfigureLight()
+    {
+        playerLight.lightType = Light2D.LightType.Point;
+        // Fixed at the largest flicker radius so the light mesh is built once
+        playerLight.pointLightOuterRadius = baseRadius + radiusVariation;
+        playerLight.intensity = baseIntensity;
+        playerLight.color = lightColor;
+        playerLight.falloffIntensity = 1f; 
     }
 }
\ No newline at end of file
@@ -0,0 +1,68 @@
+using UnityEngine;
+
+public enum FlipbookDirection
+{
+    Down = 0,
+    Left = 1,
+    Right = 2,
+    Up = 3
+}
+
+[System.Serializable]
+public class FlipbookClip
+{
+    public string clipName;
+    public Sprite[] frames = new Sprite[0];
+    public float[] frameTimes = new float[0]; // Start time of each frame in seconds
+    public float length = 1f;                 // Loop length in seconds
+
+    public bool IsValid => frames != null && frames.Length > 0 && frameTimes != null && frameTimes.Length == frames.Length;
+}
+
+// Direction-indexed idle/walk frame tables, baked from the character's animation clips
+[CreateAssetMenu(fileName = "SpriteFlipbook", menuName = "Game/Sprite Flipbook")]
+public class SpriteFlipbook : ScriptableObject
+{
+    public const int DirectionCount = 4;
+
+    [Header("Idle Clips (Down, Left, Right, Up)")]
+    public FlipbookClip[] idleClips = new FlipbookClip[DirectionCount];
+
+    [Header("Walk Clips (Down, Left, Right, Up)")]
+    public FlipbookClip[] walkClips = new FlipbookClip[DirectionCount];
+
+    public FlipbookClip GetClip(FlipbookDirection direction, bool isWalking)
+    {
+        FlipbookClip[] clips = isWalking ? walkClips : idleClips;
+        int index = (int)direction;
+
+        if (clips == null || index >= clips.Length) return null;
+        return clips[index];
+    }
+
+    // Same cardinal snapping JoystickPlayerController uses for movement
+    public static FlipbookDirection ToDirection(Vector2 cardinalDirection)
+    {
+        if (Mathf.Abs(cardinalDirection.x) > Mathf.Abs(cardinalDirection.y))
+        {
+            return cardinalDirection.x > 0 ? FlipbookDirection.Right : FlipbookDirection.Left;
+        }
+
+        return cardinalDirection.y > 0 ? FlipbookDirection.Up : FlipbookDirection.Down;
+    }
+
+    [ContextMenu("Validate Flipbook")]
+    void ValidateFlipbook()
+    {
+        for (int i = 0; i < DirectionCount; i++)
+        {
+            FlipbookDirection direction = (FlipbookDirection)i;
+
+            if (GetClip(direction, false) == null || !GetClip(direction, false).IsValid)
+                Debug.LogWarning($"Flipbook {name} missing idle clip for {direction}");
+
+            if (GetClip(direction, true) == null || !GetClip(direction, true).IsValid)
+                Debug.LogWarning($"Flipbook {name} missing walk clip for {direction}");
+        }
+    }
+}
@@ -0,0 +1,72 @@
+using UnityEngine;
+
+// Directional walk/idle playback without an Animator. Advanced by SpriteFlipbookSystem.
+public class SpriteFlipbookAnimator : MonoBehaviour
+{
+    [Header("Flipbook")]
+    public SpriteFlipbook flipbook;
+    public SpriteRenderer spriteRenderer;
+    public float playbackSpeed = 1f;
+
+    [Header("Initial State")]
+    public FlipbookDirection startDirection = FlipbookDirection.Down;
+
+    // Playback state (read and written by SpriteFlipbookSystem)
+    internal FlipbookClip currentClip;
+    internal float clipTime;
+    internal int frameIndex = -1;
+    internal int systemIndex = -1;
+
+    private FlipbookDirection direction;
+    private bool isWalking;
+
+    public FlipbookDirection Direction => direction;
+    public bool IsWalking => isWalking;
+
+    void Awake()
+    {
+        if (spriteRenderer == null)
+            spriteRenderer = GetComponent<SpriteRenderer>();
+
+        direction = startDirection;
+    }
+
+    void OnEnable()
+    {
+        SelectClip();
+        SpriteFlipbookSystem.Instance?.Register(this);
+    }
+
+    void OnDisable()
+    {
+        if (SpriteFlipbookSystem.HasInstance)
+        {
+            SpriteFlipbookSystem.Instance.Unregister(this);
+        }
+    }
+
+    // Cheap to call every frame - only restarts the clip when state actually changes
+    public void SetState(FlipbookDirection newDirection, bool walking)
+    {
+        if (newDirection == direction && walking == isWalking && currentClip != null) return;
+
+        direction = newDirection;
+        isWalking = walking;
+        SelectClip();
+    }
+
+    public void SetState(Vector2 cardinalDirection, bool walking)
+    {
+        FlipbookDirection newDirection = walking ? SpriteFlipbook.ToDirection(cardinalDirection) : direction;
+        SetState(newDirection, walking);
+    }
+
+    void SelectClip()
+    {
+        if (flipbook == null) return;
+
+        currentClip = flipbook.GetClip(direction, isWalking);
+        clipTime = 0f;
+        frameIndex = -1; // Forces the first frame to be applied on the next pass
+    }
+}
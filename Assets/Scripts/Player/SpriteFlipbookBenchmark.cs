@@ -0,0 +1,192 @@
+using UnityEngine;
+using System.Collections;
+using System.Collections.Generic;
+using System.Diagnostics;
+using Debug = UnityEngine.Debug;
+
+// Compares Animator vs SpriteFlipbookSystem cost for N directional characters.
+// Both paths are stepped manually so the stopwatch covers the same work.
+public class SpriteFlipbookBenchmark : MonoBehaviour
+{
+    [Header("Assets")]
+    public SpriteFlipbook flipbook;
+    public RuntimeAnimatorController animatorController;
+
+    [Header("Benchmark")]
+    public int[] characterCounts = { 1, 10, 100 };
+    public int warmupFrames = 30;
+    public int sampleFrames = 300;
+    public bool runOnStart = false;
+
+    private static readonly int IsWalkingHash = Animator.StringToHash("isWalking");
+    private static readonly int InputXHash = Animator.StringToHash("InputX");
+    private static readonly int InputYHash = Animator.StringToHash("InputY");
+
+    private static readonly Vector2[] Directions = { Vector2.down, Vector2.left, Vector2.right, Vector2.up };
+
+    private bool isRunning = false;
+
+    void Start()
+    {
+        if (runOnStart)
+            RunBenchmark();
+    }
+
+    [ContextMenu("Run Benchmark")]
+    public void RunBenchmark()
+    {
+        if (isRunning) return;
+
+        if (flipbook == null || animatorController == null)
+        {
+            Debug.LogWarning("[FlipbookBenchmark] Assign both a flipbook and an animator controller");
+            return;
+        }
+
+        StartCoroutine(RunAllCounts());
+    }
+
+    IEnumerator RunAllCounts()
+    {
+        isRunning = true;
+        Debug.Log("=== SPRITE FLIPBOOK BENCHMARK ===");
+
+        foreach (int count in characterCounts)
+        {
+            double animatorMs = 0;
+            double flipbookMs = 0;
+
+            yield return MeasureAnimator(count, result => animatorMs = result);
+            yield return MeasureFlipbook(count, result => flipbookMs = result);
+
+            Debug.Log($"[FlipbookBenchmark] {count} characters - Animator: {animatorMs:F4} ms/frame ({animatorMs * 1000.0 / count:F2} us each), " +
+                      $"Flipbook: {flipbookMs:F4} ms/frame ({flipbookMs * 1000.0 / count:F2} us each), " +
+                      $"speedup x{(flipbookMs > 0 ? animatorMs / flipbookMs : 0):F1}");
+        }
+
+        isRunning = false;
+    }
+
+    IEnumerator MeasureAnimator(int count, System.Action<double> onComplete)
+    {
+        List<GameObject> characters = new List<GameObject>();
+        List<Animator> animators = new List<Animator>();
+
+        for (int i = 0; i < count; i++)
+        {
+            GameObject character = CreateCharacter($"BenchAnimator_{i}", i);
+            Animator animator = character.AddComponent<Animator>();
+            animator.runtimeAnimatorController = animatorController;
+            animator.enabled = false; // Stepped manually below
+
+            characters.Add(character);
+            animators.Add(animator);
+        }
+
+        Stopwatch stopwatch = new Stopwatch();
+        int totalFrames = warmupFrames + sampleFrames;
+
+        for (int frame = 0; frame < totalFrames; frame++)
+        {
+            if (frame == warmupFrames)
+                stopwatch.Reset();
+
+            float deltaTime = Time.deltaTime;
+            stopwatch.Start();
+
+            for (int i = 0; i < animators.Count; i++)
+            {
+                // Same parameter writes JoystickPlayerController makes each frame
+                Vector2 direction = GetDirection(i, frame);
+                animators[i].SetBool(IsWalkingHash, IsWalking(i, frame));
+                animators[i].SetFloat(InputXHash, direction.x);
+                animators[i].SetFloat(InputYHash, direction.y);
+                animators[i].Update(deltaTime);
+            }
+
+            stopwatch.Stop();
+            yield return null;
+        }
+
+        DestroyAll(characters);
+        onComplete(stopwatch.Elapsed.TotalMilliseconds / sampleFrames);
+    }
+
+    IEnumerator MeasureFlipbook(int count, System.Action<double> onComplete)
+    {
+        List<GameObject> characters = new List<GameObject>();
+        List<SpriteFlipbookAnimator> flipbooks = new List<SpriteFlipbookAnimator>();
+
+        SpriteFlipbookSystem system = SpriteFlipbookSystem.Instance;
+        bool previousAutoTick = system.autoTick;
+        system.autoTick = false; // Stepped manually below
+
+        for (int i = 0; i < count; i++)
+        {
+            GameObject character = CreateCharacter($"BenchFlipbook_{i}", i);
+            character.SetActive(false);
+            SpriteFlipbookAnimator flipbookAnimator = character.AddComponent<SpriteFlipbookAnimator>();
+            flipbookAnimator.flipbook = flipbook;
+            character.SetActive(true);
+
+            characters.Add(character);
+            flipbooks.Add(flipbookAnimator);
+        }
+
+        Stopwatch stopwatch = new Stopwatch();
+        int totalFrames = warmupFrames + sampleFrames;
+
+        for (int frame = 0; frame < totalFrames; frame++)
+        {
+            if (frame == warmupFrames)
+                stopwatch.Reset();
+
+            float deltaTime = Time.deltaTime;
+            stopwatch.Start();
+
+            for (int i = 0; i < flipbooks.Count; i++)
+            {
+                flipbooks[i].SetState(GetDirection(i, frame), IsWalking(i, frame));
+            }
+
+            // Only the benchmark characters are measured; other registered animators still tick here
+            system.Tick(deltaTime);
+
+            stopwatch.Stop();
+            yield return null;
+        }
+
+        DestroyAll(characters);
+        system.autoTick = previousAutoTick;
+        onComplete(stopwatch.Elapsed.TotalMilliseconds / sampleFrames);
+    }
+
+    GameObject CreateCharacter(string characterName, int index)
+    {
+        GameObject character = new GameObject(characterName);
+        character.transform.SetParent(transform);
+        character.transform.localPosition = new Vector3(index % 10, index / 10, 0);
+        character.AddComponent<SpriteRenderer>();
+        return character;
+    }
+
+    // Change direction and walk state every second so both paths switch clips
+    Vector2 GetDirection(int index, int frame)
+    {
+        return Directions[(index + frame / 60) % Directions.Length];
+    }
+
+    bool IsWalking(int index, int frame)
+    {
+        return ((index + frame / 60) % 3) != 0;
+    }
+
+    void DestroyAll(List<GameObject> characters)
+    {
+        foreach (GameObject character in characters)
+        {
+            Destroy(character);
+        }
+        characters.Clear();
+    }
+}
@@ -0,0 +1,91 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+// Advances every SpriteFlipbookAnimator in one pass instead of one Animator update per character
+public class SpriteFlipbookSystem : PersistentSingleton<SpriteFlipbookSystem>
+{
+    [Header("Settings")]
+    public bool autoTick = true; // Disabled by SpriteFlipbookBenchmark to time Tick manually
+
+    private List<SpriteFlipbookAnimator> animators = new List<SpriteFlipbookAnimator>();
+
+    public int Count => animators.Count;
+
+    public void Register(SpriteFlipbookAnimator animator)
+    {
+        if (animator == null || animator.systemIndex >= 0) return;
+
+        animator.systemIndex = animators.Count;
+        animators.Add(animator);
+    }
+
+    public void Unregister(SpriteFlipbookAnimator animator)
+    {
+        if (animator == null || animator.systemIndex < 0) return;
+
+        // Swap-back removal
+        int index = animator.systemIndex;
+        int lastIndex = animators.Count - 1;
+        SpriteFlipbookAnimator last = animators[lastIndex];
+
+        animators[index] = last;
+        last.systemIndex = index;
+        animators.RemoveAt(lastIndex);
+
+        animator.systemIndex = -1;
+    }
+
+    void LateUpdate()
+    {
+        if (autoTick)
+            Tick(Time.deltaTime);
+    }
+
+    public void Tick(float deltaTime)
+    {
+        for (int i = 0; i < animators.Count; i++)
+        {
+            SpriteFlipbookAnimator animator = animators[i];
+            FlipbookClip clip = animator.currentClip;
+
+            if (clip == null || !clip.IsValid || animator.spriteRenderer == null) continue;
+
+            float time = animator.clipTime + deltaTime * animator.playbackSpeed;
+            int frame = animator.frameIndex < 0 ? 0 : animator.frameIndex;
+
+            // Loop
+            if (time >= clip.length && clip.length > 0f)
+            {
+                time %= clip.length;
+                frame = 0;
+            }
+
+            // Frames are sorted by start time, so only step forward
+            float[] frameTimes = clip.frameTimes;
+            while (frame + 1 < frameTimes.Length && time >= frameTimes[frame + 1])
+            {
+                frame++;
+            }
+
+            animator.clipTime = time;
+
+            // Only touch the renderer when the frame actually changes
+            if (frame != animator.frameIndex)
+            {
+                animator.frameIndex = frame;
+                animator.spriteRenderer.sprite = clip.frames[frame];
+            }
+        }
+    }
+
+    protected override void OnSingletonDestroy()
+    {
+        foreach (SpriteFlipbookAnimator animator in animators)
+        {
+            if (animator != null)
+                animator.systemIndex = -1;
+        }
+
+        animators.Clear();
+    }
+}
@@ -0,0 +1,295 @@
+using UnityEngine;
+using UnityEngine.InputSystem.EnhancedTouch;
+using UnityEngine.InputSystem.LowLevel;
+using System.Collections;
+using System.Collections.Generic;
+using Touch = UnityEngine.InputSystem.EnhancedTouch.Touch;
+using TouchPhase = UnityEngine.InputSystem.TouchPhase;
+
+// Alternate VirtualJoystick backend that reads EnhancedTouch directly instead of waiting
+// for EventSystem raycasts and IDragHandler. Runs before all other scripts so
+// JoystickPlayerController sees this frame's touch in the same Update.
+[DefaultExecutionOrder(-1000)]
+[RequireComponent(typeof(VirtualJoystick))]
+public class TouchJoystickInput : MonoBehaviour
+{
+    [Header("Touch Settings")]
+    public float activationRadiusScale = 1.25f; // Touch must start within this many joystick radii
+    public bool allowMouse = true; // Desktop and WebGL, where the EventSystem drag path is bypassed too
+
+    [Header("Latency Instrumentation")]
+    public bool measureLatency = false;
+    public Rigidbody2D measuredBody; // Usually the player's rigidbody
+    public int maxLatencySamples = 1000;
+    public int reportEverySamples = 200;
+    public float maxPendingSeconds = 0.5f;
+
+    private VirtualJoystick joystick;
+    private RectTransform background;
+
+    // Cached screen-space layout, rebuilt only when the layout changes
+    private Vector2 screenCenter;
+    private float screenRadius;
+    private bool layoutDirty = true;
+    private int lastScreenWidth;
+    private int lastScreenHeight;
+
+    private int activeTouchId = -1;
+    private bool mouseActive = false;
+
+    // Instrumentation state
+    private double pendingInputTime = -1;
+    private Vector2 lastVelocity;
+    private List<double> latencySamples = new List<double>();
+    private int samplesSinceReport = 0;
+
+    public Vector2 ScreenCenter => screenCenter;
+
+    void Awake()
+    {
+        joystick = GetComponent<VirtualJoystick>();
+        background = joystick.background != null ? joystick.background : GetComponent<RectTransform>();
+    }
+
+    void OnEnable()
+    {
+        EnhancedTouchSupport.Enable();
+        joystick.SetExternalInput(true);
+        layoutDirty = true;
+        StartCoroutine(SampleVelocityAfterSteps());
+    }
+
+    void OnDisable()
+    {
+        EnhancedTouchSupport.Disable();
+        activeTouchId = -1;
+        mouseActive = false;
+
+        if (joystick != null)
+            joystick.SetExternalInput(false);
+    }
+
+    // Called by Unity when this RectTransform (or its parents' layout) changes
+    void OnRectTransformDimensionsChange()
+    {
+        layoutDirty = true;
+    }
+
+    void UpdateLayout()
+    {
+        Canvas canvas = joystick.Canvas;
+        if (canvas == null || background == null) return;
+
+        Camera cam = canvas.renderMode == RenderMode.ScreenSpaceOverlay ? null : canvas.worldCamera;
+        screenCenter = RectTransformUtility.WorldToScreenPoint(cam, background.position);
+        screenRadius = background.sizeDelta.x * 0.5f * canvas.scaleFactor;
+
+        lastScreenWidth = Screen.width;
+        lastScreenHeight = Screen.height;
+        layoutDirty = false;
+    }
+
+    void Update()
+    {
+        if (layoutDirty || Screen.width != lastScreenWidth || Screen.height != lastScreenHeight)
+        {
+            UpdateLayout();
+        }
+
+        if (screenRadius <= 0f) return;
+
+        if (Touch.activeTouches.Count > 0)
+        {
+            SampleTouches();
+        }
+        else if (activeTouchId >= 0)
+        {
+            // Touch ended between updates
+            ReleaseJoystick(InputState.currentTime);
+        }
+        else if (allowMouse && UnityEngine.InputSystem.Mouse.current != null)
+        {
+            SampleMouse();
+        }
+    }
+
+    void SampleTouches()
+    {
+        var touches = Touch.activeTouches;
+
+        for (int i = 0; i < touches.Count; i++)
+        {
+            Touch touch = touches[i];
+
+            if (activeTouchId < 0)
+            {
+                // Claim a new touch that starts on the joystick
+                if (touch.phase == TouchPhase.Began &&
+                    (touch.screenPosition - screenCenter).sqrMagnitude <= Sqr(screenRadius * activationRadiusScale))
+                {
+                    activeTouchId = touch.touchId;
+                    ApplyPosition(touch.screenPosition, touch.time);
+                    return;
+                }
+                continue;
+            }
+
+            if (touch.touchId != activeTouchId) continue;
+
+            if (touch.phase == TouchPhase.Ended || touch.phase == TouchPhase.Canceled)
+            {
+                ReleaseJoystick(touch.time);
+            }
+            else if (touch.phase == TouchPhase.Moved || touch.phase == TouchPhase.Began)
+            {
+                ApplyPosition(touch.screenPosition, touch.time);
+            }
+            return;
+        }
+
+        // Our touch is gone from the active list
+        if (activeTouchId >= 0)
+        {
+            ReleaseJoystick(InputState.currentTime);
+        }
+    }
+
+    void SampleMouse()
+    {
+        var mouse = UnityEngine.InputSystem.Mouse.current;
+        if (mouse == null) return;
+
+        Vector2 position = mouse.position.ReadValue();
+        double time = InputState.currentTime;
+
+        if (mouse.leftButton.wasPressedThisFrame &&
+            (position - screenCenter).sqrMagnitude <= Sqr(screenRadius * activationRadiusScale))
+        {
+            mouseActive = true;
+        }
+
+        if (!mouseActive) return;
+
+        if (mouse.leftButton.isPressed)
+        {
+            ApplyPosition(position, time);
+        }
+        else
+        {
+            mouseActive = false;
+            ReleaseJoystick(time);
+        }
+    }
+
+    void ApplyPosition(Vector2 screenPosition, double inputTime)
+    {
+        Vector2 previous = joystick.inputVector;
+        joystick.SetInput((screenPosition - screenCenter) / screenRadius);
+        MarkInput(previous, inputTime);
+    }
+
+    void ReleaseJoystick(double inputTime)
+    {
+        Vector2 previous = joystick.inputVector;
+        activeTouchId = -1;
+        joystick.ResetInput();
+        MarkInput(previous, inputTime);
+    }
+
+    void MarkInput(Vector2 previous, double inputTime)
+    {
+        // Only timestamp the first unanswered input change
+        if (measureLatency && pendingInputTime < 0 && previous != joystick.inputVector)
+        {
+            pendingInputTime = inputTime;
+        }
+    }
+
+    // Velocity is written in FixedUpdate on the simulation tick, so it is read after each
+    // fixed step rather than per frame. FixedUpdate still runs while idle physics is skipped.
+    IEnumerator SampleVelocityAfterSteps()
+    {
+        WaitForFixedUpdate afterStep = new WaitForFixedUpdate();
+
+        while (true)
+        {
+            yield return afterStep;
+
+            if (measureLatency && measuredBody != null)
+                SampleVelocity();
+        }
+    }
+
+    void SampleVelocity()
+    {
+        Vector2 velocity = measuredBody.linearVelocity;
+        double now = InputState.currentTime;
+
+        if (velocity != lastVelocity)
+        {
+            if (pendingInputTime >= 0)
+            {
+                RecordLatency(now - pendingInputTime);
+                pendingInputTime = -1;
+            }
+            lastVelocity = velocity;
+        }
+        else if (pendingInputTime >= 0 && now - pendingInputTime > maxPendingSeconds)
+        {
+            // Input changed without moving the body (inside dead zone, same cardinal direction)
+            pendingInputTime = -1;
+        }
+    }
+
+    void RecordLatency(double seconds)
+    {
+        if (latencySamples.Count >= maxLatencySamples)
+            latencySamples.RemoveAt(0);
+
+        latencySamples.Add(seconds * 1000.0);
+        samplesSinceReport++;
+
+        if (reportEverySamples > 0 && samplesSinceReport >= reportEverySamples)
+        {
+            ReportLatency();
+        }
+    }
+
+    [ContextMenu("Report Latency")]
+    public void ReportLatency()
+    {
+        samplesSinceReport = 0;
+
+        if (latencySamples.Count == 0)
+        {
+            Debug.Log("[TouchJoystick] No latency samples recorded yet");
+            return;
+        }
+
+        Debug.Log($"[TouchJoystick] Touch-to-velocity latency over {latencySamples.Count} samples - " +
+                  $"p50: {GetLatencyPercentile(0.5f):F2} ms, p99: {GetLatencyPercentile(0.99f):F2} ms");
+    }
+
+    public double GetLatencyPercentile(float percentile)
+    {
+        if (latencySamples.Count == 0) return 0;
+
+        List<double> sorted = new List<double>(latencySamples);
+        sorted.Sort();
+
+        int index = Mathf.Clamp(Mathf.CeilToInt(percentile * sorted.Count) - 1, 0, sorted.Count - 1);
+        return sorted[index];
+    }
+
+    [ContextMenu("Clear Latency Samples")]
+    public void ClearLatencySamples()
+    {
+        latencySamples.Clear();
+        samplesSinceReport = 0;
+    }
+
+    static float Sqr(float value)
+    {
+        return value * value;
+    }
+}
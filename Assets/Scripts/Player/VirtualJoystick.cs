@@ -19,11 +19,19 @@ public class VirtualJoystick : MonoBehaviour, IPointerDownHandler, IDragHandler,
     private Vector2 backgroundCenter;
     private Canvas canvas;
     private Camera cam;
+    private bool externalInput = false; // Set when another backend (TouchJoystickInput) feeds input
 
-    void Start()
+    public Canvas Canvas => canvas;
+    public Camera EventCamera => cam;
+
+    void Awake()
     {
         // Get components
         canvas = GetComponentInParent<Canvas>();
+    }
+
+    void Start()
+    {
 
         // Set background reference if not assigned
         if (background == null)
@@ -49,10 +57,18 @@ public class VirtualJoystick : MonoBehaviour, IPointerDownHandler, IDragHandler,
 
     public void OnDrag(PointerEventData eventData)
     {
+        if (externalInput) return;
+
         Vector2 position = RectTransformUtility.WorldToScreenPoint(cam, background.position);
         Vector2 radius = background.sizeDelta / 2;
 
-        inputVector = (eventData.position - position) / (radius * canvas.scaleFactor);
+        SetInput((eventData.position - position) / (radius * canvas.scaleFactor));
+    }
+
+    // Shared by the EventSystem path and external backends
+    public void SetInput(Vector2 rawInput)
+    {
+        inputVector = rawInput;
 
         // Clamp input to unit circle
         if (inputVector.magnitude > 1f)
@@ -89,9 +105,25 @@ public class VirtualJoystick : MonoBehaviour, IPointerDownHandler, IDragHandler,
     }
 
     public void OnPointerUp(PointerEventData eventData)
+    {
+        if (externalInput) return;
+
+        ResetInput();
+    }
+
+    public void ResetInput()
     {
         inputVector = Vector2.zero;
-        handle.anchoredPosition = Vector2.zero;
+
+        if (handle != null)
+            handle.anchoredPosition = Vector2.zero;
+    }
+
+    // While enabled, EventSystem drag callbacks are ignored
+    public void SetExternalInput(bool enabled)
+    {
+        externalInput = enabled;
+        ResetInput();
     }
 
     // Public methods to get input
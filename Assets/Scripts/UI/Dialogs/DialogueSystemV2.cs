@@ -1,7 +1,6 @@
 using UnityEngine;
 using UnityEngine.UI;
 using TMPro;
-using System.Collections;
 using System.Collections.Generic;
 
 [System.Serializable]
@@ -23,7 +22,7 @@ public class SpeakerData
     public AudioClip[] typingSounds;
 }
 
-public class DialogueSystemV2 : MonoBehaviour
+public class DialogueSystemV2 : MonoBehaviour, ITweenCallback
 {
     [Header("UI Components")]
     public GameObject dialoguePanel;
@@ -48,9 +47,15 @@ public class DialogueSystemV2 : MonoBehaviour
     private int currentLineIndex = 0;
     private bool isDialogueActive = false;
     private bool isTyping = false;
-    private bool skipTyping = false;
-    private Coroutine typingCoroutine;
+    private TweenHandle typingTween; // Per-character delay, then the auto-advance delay
+    private DialogueLine typingLine;
+    private SpeakerData typingSpeaker;
+    private int typedCharacters = 0;
+    private int soundCounter = 0;
     private string fullText = "";
+
+    const int TypeCharacterTag = 0;
+    const int AutoAdvanceTag = 1;
     private float baseTypingSoundVolume; // Store original volume
 
     public static DialogueSystemV2 Instance { get; private set; }
@@ -93,9 +98,21 @@ public class DialogueSystemV2 : MonoBehaviour
             dialoguePanel.SetActive(false);
         }
 
+        // Baked room references first
+        RoomContext room = RoomContext.Current;
+        if (room != null)
+        {
+            if (playerController == null)
+                playerController = room.playerController;
+
+            if (joystickUI == null)
+                joystickUI = room.joystickUI;
+        }
+
         // Find player controller if not assigned
         if (playerController == null)
         {
+            RoomContext.ReportFallback("Dialogue player controller");
             playerController = FindFirstObjectByType<JoystickPlayerController>();
             if (playerController == null)
             {
@@ -107,6 +124,7 @@ public class DialogueSystemV2 : MonoBehaviour
         if (joystickUI == null)
         {
             // Try to find the joystick by name or component
+            RoomContext.ReportFallback("Dialogue joystick UI");
             GameObject foundJoystick = GameObject.Find("Joystick");
             Debug.Log("Found Joystick by name: " + (foundJoystick != null ? foundJoystick.name : "NULL"));
 
@@ -132,6 +150,28 @@ public class DialogueSystemV2 : MonoBehaviour
         Debug.Log("DialogueSystem initialized with joystick: " + (joystickUI != null ? joystickUI.name : "NULL"));
     }
 
+    // Each room has its own dialogue canvas, player and joystick; use the awake room's
+    public void BindRoom(RoomContext room)
+    {
+        if (room.playerController != null)
+            playerController = room.playerController;
+        if (room.joystickUI != null)
+            joystickUI = room.joystickUI;
+
+        if (room.dialoguePanel == null || room.dialoguePanel == dialoguePanel) return;
+
+        if (isDialogueActive)
+            EndDialogue();
+
+        dialoguePanel = room.dialoguePanel;
+        dialogueBoxImage = room.dialogueBoxImage;
+        dialogueText = room.dialogueText;
+        speakerNameText = room.speakerNameText;
+
+        // Only the first room's panel was hidden at startup
+        dialoguePanel.SetActive(false);
+    }
+
     void ConnectToAudioMixer()
     {
         if (audioSource != null)
@@ -143,6 +183,18 @@ public class DialogueSystemV2 : MonoBehaviour
                 return;
             }
 
+            // Voice manager already has the mixer (set by the bootstrap or pause menu)
+            if (AudioVoiceManager.HasInstance)
+            {
+                UnityEngine.Audio.AudioMixerGroup dialogueGroup = AudioVoiceManager.Instance.GetMixerGroup(AudioCategory.Dialogue);
+                if (dialogueGroup != null)
+                {
+                    audioSource.outputAudioMixerGroup = dialogueGroup;
+                    Debug.Log("Connected DialogueSystem AudioSource to " + dialogueGroup.name + " via AudioVoiceManager");
+                    return;
+                }
+            }
+
             // If not connected, try to find and connect automatically
             UnityEngine.Audio.AudioMixer[] mixers = Resources.FindObjectsOfTypeAll<UnityEngine.Audio.AudioMixer>();
 
@@ -212,11 +264,8 @@ public class DialogueSystemV2 : MonoBehaviour
         if (isTyping)
         {
             // Skip typing animation and stop sounds immediately
-            skipTyping = true;
-            if (audioSource != null)
-            {
-                audioSource.Stop();
-            }
+            KillTypingTween();
+            FinishTyping();
         }
         else
         {
@@ -291,16 +340,15 @@ public class DialogueSystemV2 : MonoBehaviour
 
         DialogueLine currentLine = currentDialogue[currentLineIndex];
 
+        // Typing animates every character, so render at full rate
+        ReleaseIdlePacing();
+
         // Update speaker visuals
         UpdateSpeakerVisuals(currentLine.speakerName);
 
         // Start typing animation
-        if (typingCoroutine != null)
-        {
-            StopCoroutine(typingCoroutine);
-        }
-
-        typingCoroutine = StartCoroutine(TypeText(currentLine));
+        KillTypingTween();
+        BeginTyping(currentLine);
     }
 
     void UpdateSpeakerVisuals(string speakerName)
@@ -350,52 +398,59 @@ public class DialogueSystemV2 : MonoBehaviour
         return null;
     }
 
-    IEnumerator TypeText(DialogueLine line)
+    // Typewriter on pooled delays instead of a coroutine: the text is set once and
+    // revealed with maxVisibleCharacters, so each character costs no allocation
+    void BeginTyping(DialogueLine line)
     {
         isTyping = true;
-        skipTyping = false;
         fullText = line.text;
+        typingLine = line;
+        typingSpeaker = GetSpeakerData(line.speakerName);
+        typedCharacters = 0;
+        soundCounter = 0;
 
-        // Clear text
         if (dialogueText != null)
         {
-            dialogueText.text = "";
+            dialogueText.text = fullText;
+            dialogueText.maxVisibleCharacters = 0;
         }
 
-        SpeakerData speaker = GetSpeakerData(line.speakerName);
-        int soundCounter = 0;
+        TypeNextCharacter();
+    }
 
-        // Type each character
-        for (int i = 0; i < fullText.Length; i++)
+    void TypeNextCharacter()
+    {
+        if (typedCharacters >= fullText.Length)
         {
-            // Check if we should skip typing
-            if (skipTyping)
-            {
-                break;
-            }
+            FinishTyping();
+            return;
+        }
 
-            // Add next character
-            if (dialogueText != null)
-            {
-                dialogueText.text = fullText.Substring(0, i + 1);
-            }
+        // Add next character
+        typedCharacters++;
+        if (dialogueText != null)
+        {
+            dialogueText.maxVisibleCharacters = typedCharacters;
+        }
 
-            // Play typing sound based on character counter
-            char currentChar = fullText[i];
-            if (!char.IsWhiteSpace(currentChar)) // Don't play sound for spaces
+        // Play typing sound based on character counter
+        char currentChar = fullText[typedCharacters - 1];
+        if (!char.IsWhiteSpace(currentChar)) // Don't play sound for spaces
+        {
+            soundCounter++;
+            if (soundCounter >= charactersPerSound)
             {
-                soundCounter++;
-                if (soundCounter >= charactersPerSound)
-                {
-                    PlayTypingSound(speaker);
-                    soundCounter = 0;
-                }
+                PlayTypingSound(typingSpeaker);
+                soundCounter = 0;
             }
-
-            // Wait for next character
-            yield return new WaitForSeconds(line.typewriterSpeed);
         }
 
+        // Wait for next character
+        ScheduleTyping(typingLine.typewriterSpeed, TypeCharacterTag);
+    }
+
+    void FinishTyping()
+    {
         // Stop any lingering typing sounds
         if (audioSource != null)
         {
@@ -405,22 +460,50 @@ public class DialogueSystemV2 : MonoBehaviour
         // Ensure full text is displayed
         if (dialogueText != null)
         {
-            dialogueText.text = fullText;
+            dialogueText.maxVisibleCharacters = 99999; // TMP default
         }
 
         isTyping = false;
-        skipTyping = false;
 
         Debug.Log($"Finished typing: {fullText}");
 
+        // Text is static until the player taps, so let the frame rate drop
+        if (typingLine.waitForInput)
+        {
+            FramePacingManager.Instance?.RequestIdle("Dialogue");
+        }
+
         // Auto-advance if not waiting for input
-        if (!line.waitForInput)
+        if (!typingLine.waitForInput)
         {
-            yield return new WaitForSeconds(2f);
-            NextLine();
+            ScheduleTyping(2f, AutoAdvanceTag);
         }
     }
 
+    void ScheduleTyping(float delay, int tag)
+    {
+        TweenScheduler tweens = TweenScheduler.Instance;
+        if (tweens != null)
+            typingTween = tweens.OnComplete(tweens.Delay(delay), this, tag);
+    }
+
+    void KillTypingTween()
+    {
+        if (TweenScheduler.HasInstance)
+            TweenScheduler.Instance.Kill(typingTween);
+        typingTween = default;
+    }
+
+    public void OnTweenComplete(int tag)
+    {
+        typingTween = default;
+
+        if (tag == TypeCharacterTag)
+            TypeNextCharacter();
+        else if (tag == AutoAdvanceTag)
+            NextLine();
+    }
+
     void PlayTypingSound(SpeakerData speaker)
     {
         if (audioSource != null && speaker != null && speaker.typingSounds != null && speaker.typingSounds.Length > 0)
@@ -469,12 +552,10 @@ public class DialogueSystemV2 : MonoBehaviour
         isDialogueActive = false;
         isTyping = false;
 
-        // Stop typing coroutine
-        if (typingCoroutine != null)
-        {
-            StopCoroutine(typingCoroutine);
-            typingCoroutine = null;
-        }
+        ReleaseIdlePacing();
+
+        // Stop typing
+        KillTypingTween();
 
         // Stop any playing audio
         if (audioSource != null)
@@ -509,6 +590,12 @@ public class DialogueSystemV2 : MonoBehaviour
         currentLineIndex = 0;
     }
 
+    void ReleaseIdlePacing()
+    {
+        if (FramePacingManager.HasInstance)
+            FramePacingManager.Instance.ReleaseIdle("Dialogue");
+    }
+
     public bool IsDialogueActive()
     {
         return isDialogueActive;
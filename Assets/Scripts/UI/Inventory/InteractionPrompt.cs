@@ -0,0 +1,186 @@
+using UnityEngine;
+using UnityEngine.UI;
+using TMPro;
+using System.Collections.Generic;
+
+// The one "Press E to ..." prompt in a scene. Interactables hand it their precomputed
+// text when the player comes in range; the nearest one has focus and the prompt follows
+// it on a small overlay canvas of its own, so moving it never re-batches other UI.
+[DefaultExecutionOrder(1000)] // After CameraFollow, so the prompt doesn't trail the camera by a frame
+public class InteractionPrompt : PersistentSingleton<InteractionPrompt>
+{
+    [Header("Layout")]
+    public Vector3 worldOffset = new Vector3(0f, 0.6f, 0f);
+    public int sortingOrder = 50;
+    public float fontSize = 28f;
+    public Vector2 padding = new Vector2(24f, 12f);
+    public Color backgroundColor = new Color(0f, 0f, 0f, 0.6f);
+
+    struct Candidate
+    {
+        public Object owner;
+        public Transform anchor;
+        public string text;
+    }
+
+    private readonly List<Candidate> candidates = new List<Candidate>();
+    private RectTransform panel;
+    private TextMeshProUGUI label;
+    private Object focusedOwner;
+    private Camera worldCamera;
+    private PixelPerfectRenderer pixelRenderer;
+    private Vector2 lastScreenPosition = new Vector2(float.NaN, float.NaN);
+
+    public Object FocusedOwner => focusedOwner;
+
+    protected override void OnSingletonAwake()
+    {
+        CreateWidget();
+    }
+
+    void CreateWidget()
+    {
+        gameObject.layer = LayerMask.NameToLayer("UI");
+
+        Canvas canvas = gameObject.AddComponent<Canvas>();
+        canvas.renderMode = RenderMode.ScreenSpaceOverlay;
+        canvas.sortingOrder = sortingOrder;
+
+        // Same scaling as the rest of the HUD
+        CanvasScaler scaler = gameObject.AddComponent<CanvasScaler>();
+        scaler.uiScaleMode = CanvasScaler.ScaleMode.ScaleWithScreenSize;
+        scaler.referenceResolution = new Vector2(1920f, 1080f);
+        scaler.matchWidthOrHeight = 0.5f;
+
+        GameObject panelObj = new GameObject("Panel");
+        panelObj.layer = gameObject.layer;
+        panelObj.transform.SetParent(transform, false);
+        Image background = panelObj.AddComponent<Image>();
+        background.color = backgroundColor;
+        background.raycastTarget = false;
+        panel = background.rectTransform;
+        panel.anchorMin = panel.anchorMax = Vector2.zero;
+        panel.pivot = new Vector2(0.5f, 0f);
+
+        GameObject labelObj = new GameObject("Label");
+        labelObj.layer = gameObject.layer;
+        labelObj.transform.SetParent(panelObj.transform, false);
+        label = labelObj.AddComponent<TextMeshProUGUI>();
+        label.fontSize = fontSize;
+        label.alignment = TextAlignmentOptions.Center;
+        label.raycastTarget = false;
+        label.textWrappingMode = TextWrappingModes.NoWrap;
+
+        RectTransform labelRect = label.rectTransform;
+        labelRect.anchorMin = Vector2.zero;
+        labelRect.anchorMax = Vector2.one;
+        labelRect.offsetMin = Vector2.zero;
+        labelRect.offsetMax = Vector2.zero;
+
+        panelObj.SetActive(false);
+    }
+
+    // Called when the player comes in range; text should be built once by the caller
+    public void Show(Object owner, Transform anchor, string text)
+    {
+        for (int i = 0; i < candidates.Count; i++)
+        {
+            if (candidates[i].owner == owner)
+            {
+                candidates[i] = new Candidate { owner = owner, anchor = anchor, text = text };
+                if (owner == focusedOwner)
+                    focusedOwner = null; // Re-apply the new text
+                return;
+            }
+        }
+
+        candidates.Add(new Candidate { owner = owner, anchor = anchor, text = text });
+    }
+
+    public void Hide(Object owner)
+    {
+        for (int i = candidates.Count - 1; i >= 0; i--)
+        {
+            if (candidates[i].owner == owner)
+                candidates.RemoveAt(i);
+        }
+    }
+
+    void LateUpdate()
+    {
+        int focus = FindFocus();
+        if (focus < 0)
+        {
+            if (focusedOwner != null || panel.gameObject.activeSelf)
+            {
+                focusedOwner = null;
+                panel.gameObject.SetActive(false);
+            }
+            return;
+        }
+
+        Candidate candidate = candidates[focus];
+
+        // Text only changes with focus, so TMP lays out once per approach
+        if (candidate.owner != focusedOwner)
+        {
+            focusedOwner = candidate.owner;
+            label.text = candidate.text;
+            panel.sizeDelta = label.GetPreferredValues(candidate.text) + padding * 2f;
+            panel.gameObject.SetActive(true);
+            lastScreenPosition = new Vector2(float.NaN, float.NaN);
+        }
+
+        Vector2 screenPosition = WorldToScreen(candidate.anchor.position + worldOffset);
+        if (screenPosition != lastScreenPosition)
+        {
+            lastScreenPosition = screenPosition;
+            panel.position = screenPosition;
+        }
+    }
+
+    // Nearest in-range interactable to the player
+    int FindFocus()
+    {
+        // Destroyed without hiding (scene unload)
+        for (int i = candidates.Count - 1; i >= 0; i--)
+        {
+            if (candidates[i].owner == null || candidates[i].anchor == null)
+                candidates.RemoveAt(i);
+        }
+
+        Transform player = RoomContext.Player;
+        int best = -1;
+        float bestDistance = float.MaxValue;
+
+        for (int i = 0; i < candidates.Count; i++)
+        {
+            float distance = player != null ? (candidates[i].anchor.position - player.position).sqrMagnitude : 0f;
+            if (distance < bestDistance)
+            {
+                bestDistance = distance;
+                best = i;
+            }
+        }
+
+        return best;
+    }
+
+    Vector2 WorldToScreen(Vector3 position)
+    {
+        // Each room has its own camera; follow whichever one is awake
+        if (worldCamera == null || !worldCamera.isActiveAndEnabled)
+        {
+            worldCamera = Camera.main;
+            pixelRenderer = worldCamera != null ? worldCamera.GetComponent<PixelPerfectRenderer>() : null;
+        }
+
+        if (worldCamera == null) return Vector2.zero;
+
+        // The world camera renders into the low-res target, not the screen
+        if (pixelRenderer != null && pixelRenderer.isActiveAndEnabled)
+            return pixelRenderer.WorldToScreenPoint(position);
+
+        return worldCamera.WorldToScreenPoint(position);
+    }
+}
@@ -48,10 +48,29 @@ public class InventoryManager : MonoBehaviour
             inventoryUI = FindFirstObjectByType<InventoryUI>();
         }
 
+        // SaveSystem may load after this Start (or be handed a bootstrap read later)
+        if (SaveSystem.Instance != null)
+        {
+            SaveSystem.Instance.OnGameLoaded += OnGameLoaded;
+        }
+
         // Load inventory from save system
         LoadInventoryFromSave();
     }
 
+    void OnDestroy()
+    {
+        if (Instance == this && SaveSystem.Instance != null)
+        {
+            SaveSystem.Instance.OnGameLoaded -= OnGameLoaded;
+        }
+    }
+
+    void OnGameLoaded(GameSaveData saveData)
+    {
+        RefreshUI();
+    }
+
     void LoadInventoryFromSave()
     {
         if (SaveSystem.Instance == null) return;
@@ -293,14 +312,7 @@ public class InventoryManager : MonoBehaviour
     {
         if (clip == null) return;
 
-        // Hook into your audio system
-        AudioSource audioSource = GetComponent<AudioSource>();
-        if (audioSource == null)
-        {
-            audioSource = gameObject.AddComponent<AudioSource>();
-        }
-
-        audioSource.PlayOneShot(clip);
+        AudioVoiceManager.Instance?.Play(clip, AudioCategory.Interaction);
     }
 
     // Public utility methods
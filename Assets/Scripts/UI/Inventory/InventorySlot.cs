@@ -22,6 +22,8 @@ public class InventorySlot : MonoBehaviour, IPointerClickHandler, IPointerEnterH
     private InventoryUI inventoryUI;
     private bool isEmpty = true;
     private bool isHovered = false;
+    private TweenHandle flashTween;
+    private Color iconRestColor = Color.white;
 
     public InventoryItem CurrentItem => currentItem;
     public bool IsEmpty => isEmpty;
@@ -167,75 +169,38 @@ public class InventorySlot : MonoBehaviour, IPointerClickHandler, IPointerEnterH
         // AudioManager.Instance?.PlaySFX("inventory_hover");
     }
 
-    // Animation helpers
+    // Animation helpers - pooled tweens, so repeated pickups/uses allocate nothing
     public void AnimatePickup()
     {
         if (isEmpty) return;
 
-        // Simple scale animation using Unity's built-in system
-        StartCoroutine(ScaleAnimation(gameObject.transform, Vector3.one * 1.2f, 0.1f, () => {
-            StartCoroutine(ScaleAnimation(gameObject.transform, Vector3.one, 0.1f));
-        }));
-    }
-
-    public void AnimateUse()
-    {
-        if (isEmpty) return;
+        TweenScheduler tweens = TweenScheduler.Instance;
+        if (tweens == null) return;
 
-        // Flash animation to indicate item use
-        StartCoroutine(FlashAnimation());
+        // Pop up and settle back (ease out quad, unscaled so it plays while paused)
+        tweens.KillAll(transform);
+        tweens.Then(
+            tweens.Scale(transform, Vector3.one * 1.2f, 0.1f, TweenEase.OutQuad, true),
+            tweens.Scale(transform, Vector3.one, 0.1f, TweenEase.OutQuad, true));
     }
 
-    // Unity built-in scale animation
-    System.Collections.IEnumerator ScaleAnimation(Transform target, Vector3 targetScale, float duration, System.Action onComplete = null)
-    {
-        Vector3 startScale = target.localScale;
-        float elapsed = 0f;
-
-        while (elapsed < duration)
-        {
-            elapsed += Time.unscaledDeltaTime;
-            float progress = elapsed / duration;
-
-            // Ease out quad
-            progress = 1f - (1f - progress) * (1f - progress);
-
-            target.localScale = Vector3.Lerp(startScale, targetScale, progress);
-            yield return null;
-        }
-
-        target.localScale = targetScale;
-        onComplete?.Invoke();
-    }
-
-    // Flash animation for item use
-    System.Collections.IEnumerator FlashAnimation()
+    public void AnimateUse()
     {
-        Color originalColor = itemIcon.color;
-        Color flashColor = new Color(originalColor.r, originalColor.g, originalColor.b, 0.3f);
+        if (isEmpty || itemIcon == null) return;
 
-        // Fade to flash color
-        yield return StartCoroutine(ColorAnimation(itemIcon, flashColor, 0.15f));
+        TweenScheduler tweens = TweenScheduler.Instance;
+        if (tweens == null) return;
 
-        // Fade back to original
-        yield return StartCoroutine(ColorAnimation(itemIcon, originalColor, 0.15f));
-    }
+        // A flash already running restores to the color it started from
+        if (!tweens.IsActive(flashTween))
+            iconRestColor = itemIcon.color;
+        tweens.KillAll(itemIcon);
 
-    // Color animation helper
-    System.Collections.IEnumerator ColorAnimation(Image target, Color targetColor, float duration)
-    {
-        Color startColor = target.color;
-        float elapsed = 0f;
-
-        while (elapsed < duration)
-        {
-            elapsed += Time.unscaledDeltaTime;
-            float progress = elapsed / duration;
-            target.color = Color.Lerp(startColor, targetColor, progress);
-            yield return null;
-        }
-
-        target.color = targetColor;
+        // Flash animation to indicate item use
+        Color flashColor = new Color(iconRestColor.r, iconRestColor.g, iconRestColor.b, 0.3f);
+        flashTween = tweens.Then(
+            tweens.Color(itemIcon, flashColor, 0.15f, TweenEase.Linear, true),
+            tweens.Color(itemIcon, iconRestColor, 0.15f, TweenEase.Linear, true));
     }
 
     // Utility method for external systems
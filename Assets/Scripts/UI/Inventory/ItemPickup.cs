@@ -1,8 +1,6 @@
 using UnityEngine;
-using UnityEngine.UI;
-using TMPro;
 
-public class ItemPickup : MonoBehaviour
+public class ItemPickup : MonoBehaviour, ITweenCallback
 {
     [Header("Item Configuration")]
     public string itemId;
@@ -19,11 +17,6 @@ public class ItemPickup : MonoBehaviour
     public float interactionRange = 2f;
     public LayerMask playerLayerMask = -1;
 
-    [Header("UI Feedback")]
-    public GameObject interactionPrompt;
-    public TextMeshProUGUI promptText;
-    public Canvas worldSpaceCanvas;
-
     [Header("Animation")]
     public float bobAmount = 0.5f;
     public float bobSpeed = 2f;
@@ -37,7 +30,11 @@ public class ItemPickup : MonoBehaviour
     private Transform playerTransform;
     private Vector3 startPosition;
     private InventoryItem itemData;
+    private string promptString;
     private bool isRegistered = false;
+    private bool hasStarted = false;
+
+    const float PickupAnimationTime = 0.5f;
 
     void Start()
     {
@@ -62,17 +59,40 @@ public class ItemPickup : MonoBehaviour
             }
         }
 
-        // Setup interaction prompt
-        if (interactionPrompt != null)
-        {
-            interactionPrompt.SetActive(false);
-        }
+        // Built once; the shared prompt just displays it
+        string itemName = itemData != null ? itemData.itemName : itemId;
+        promptString = $"Press {interactKey} to pick up {itemName}";
 
         // Check if already picked up
         CheckPickupStatus();
 
         // Register with save system
         RegisterWithSaveSystem();
+
+        // Idle bob/spin is batched with all other pickups
+        hasStarted = true;
+        StartIdleAnimation();
+    }
+
+    void OnEnable()
+    {
+        if (hasStarted)
+        {
+            StartIdleAnimation();
+        }
+    }
+
+    void OnDisable()
+    {
+        StopIdleAnimation();
+        HidePrompt();
+
+        // A disabled pickup stops animating, as its coroutine used to
+        if (TweenScheduler.HasInstance)
+        {
+            TweenScheduler.Instance.KillAll(transform);
+            TweenScheduler.Instance.KillAll(itemSprite);
+        }
     }
 
     void CheckPickupStatus()
@@ -103,9 +123,6 @@ public class ItemPickup : MonoBehaviour
     {
         if (isPickedUp) return;
 
-        // Animate item
-        AnimateItem();
-
         // Check for player in range
         CheckPlayerProximity();
 
@@ -116,22 +133,29 @@ public class ItemPickup : MonoBehaviour
         }
     }
 
-    void AnimateItem()
+    void StartIdleAnimation()
     {
-        if (!playPickupAnimation) return;
+        if (!playPickupAnimation || isPickedUp) return;
 
-        // Bob up and down
-        float bobOffset = Mathf.Sin(Time.time * bobSpeed) * bobAmount;
-        transform.position = startPosition + Vector3.up * bobOffset;
+        ItemAnimationSystem.Instance?.Register(transform, startPosition, bobAmount, bobSpeed, rotationSpeed);
+    }
 
-        // Rotate slowly
-        transform.Rotate(Vector3.up, rotationSpeed * Time.deltaTime);
+    void StopIdleAnimation()
+    {
+        if (ItemAnimationSystem.HasInstance)
+        {
+            ItemAnimationSystem.Instance.Unregister(transform);
+        }
     }
 
     void CheckPlayerProximity()
     {
+        if (playerTransform == null)
+            playerTransform = RoomContext.Player;
+
         if (playerTransform == null)
         {
+            RoomContext.ReportFallback("Pickup player");
             GameObject player = GameObject.FindGameObjectWithTag("Player");
             if (player != null)
             {
@@ -150,18 +174,19 @@ public class ItemPickup : MonoBehaviour
         // Show/hide interaction prompt
         if (playerInRange != wasInRange)
         {
-            if (interactionPrompt != null)
-            {
-                interactionPrompt.SetActive(playerInRange);
-
-                if (playerInRange && promptText != null && itemData != null)
-                {
-                    promptText.text = $"Press {interactKey} to pick up {itemData.itemName}";
-                }
-            }
+            if (playerInRange)
+                InteractionPrompt.Instance?.Show(this, transform, promptString);
+            else
+                HidePrompt();
         }
     }
 
+    void HidePrompt()
+    {
+        if (InteractionPrompt.HasInstance)
+            InteractionPrompt.Instance.Hide(this);
+    }
+
     public void PickupItem()
     {
         if (isPickedUp || InventoryManager.Instance == null) return;
@@ -172,26 +197,24 @@ public class ItemPickup : MonoBehaviour
         if (success)
         {
             isPickedUp = true;
+            StopIdleAnimation();
 
             // Play pickup sound
             if (pickupSound != null)
             {
-                AudioSource.PlayClipAtPoint(pickupSound, transform.position);
+                AudioVoiceManager.Instance?.PlayAt(pickupSound, AudioCategory.Interaction, transform.position);
             }
 
             // Show pickup message
             ShowPickupMessage();
 
             // Hide interaction prompt
-            if (interactionPrompt != null)
-            {
-                interactionPrompt.SetActive(false);
-            }
+            HidePrompt();
 
             // Pickup animation
             if (playPickupAnimation)
             {
-                StartCoroutine(PickupAnimation());
+                PlayPickupAnimation();
             }
             else if (hideAfterPickup)
             {
@@ -201,7 +224,8 @@ public class ItemPickup : MonoBehaviour
             // Mark as examined in save system
             if (SaveSystem.Instance != null && isRegistered)
             {
-                string objectId = $"pickup_{itemId}_{transform.position}";
+                // Resting position, the one the id was registered under; the item may be mid-bob
+                string objectId = $"pickup_{itemId}_{startPosition}";
                 SaveSystem.Instance.MarkObjectExamined(objectId);
             }
 
@@ -227,37 +251,25 @@ public class ItemPickup : MonoBehaviour
         }
     }
 
-    System.Collections.IEnumerator PickupAnimation()
+    void PlayPickupAnimation()
     {
-        // Animate item flying up and scaling down
-        Vector3 originalScale = transform.localScale;
-        Vector3 targetPosition = transform.position + Vector3.up * 2f;
-
-        float animationTime = 0.5f;
-        float elapsed = 0f;
-
-        while (elapsed < animationTime)
+        TweenScheduler tweens = TweenScheduler.Instance;
+        if (tweens == null)
         {
-            float progress = elapsed / animationTime;
-
-            // Move up
-            transform.position = Vector3.Lerp(startPosition, targetPosition, progress);
-
-            // Scale down
-            transform.localScale = Vector3.Lerp(originalScale, Vector3.zero, progress);
-
-            // Fade out if has sprite renderer
-            if (itemSprite != null)
-            {
-                Color color = itemSprite.color;
-                color.a = 1f - progress;
-                itemSprite.color = color;
-            }
-
-            elapsed += Time.deltaTime;
-            yield return null;
+            OnTweenComplete(0);
+            return;
         }
 
+        // Animate item flying up, scaling down and fading out (if it has a sprite renderer).
+        // Starts from wherever the bob left it so the item doesn't jump.
+        tweens.OnComplete(tweens.Move(transform, transform.position + Vector3.up * 2f, PickupAnimationTime), this);
+        tweens.Scale(transform, Vector3.zero, PickupAnimationTime);
+        tweens.Alpha(itemSprite, 0f, PickupAnimationTime);
+    }
+
+    // End of the pickup animation
+    public void OnTweenComplete(int tag)
+    {
         if (hideAfterPickup)
         {
             gameObject.SetActive(false);
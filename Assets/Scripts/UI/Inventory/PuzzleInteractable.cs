@@ -15,7 +15,7 @@ public class PuzzleInteractable : MonoBehaviour
     public KeyCode interactKey = KeyCode.E;
 
     [Header("Feedback")]
-    public GameObject interactionPrompt;
+    public string promptAction = "examine"; // "Press E to examine"
     public string puzzleCompleteName = "Puzzle";
     public string missingItemsMessage = "You need the right items to solve this.";
     public string alreadySolvedMessage = "This puzzle has already been solved.";
@@ -33,6 +33,7 @@ public class PuzzleInteractable : MonoBehaviour
     private bool isPlayerInRange = false;
     private bool isPuzzleSolved = false;
     private Transform playerTransform;
+    private string promptString;
 
     void Start()
     {
@@ -42,10 +43,14 @@ public class PuzzleInteractable : MonoBehaviour
             isPuzzleSolved = SaveSystem.Instance.IsPuzzleSolved(puzzleId);
         }
 
-        if (interactionPrompt != null)
-        {
-            interactionPrompt.SetActive(false);
-        }
+        // Built once; the shared prompt just displays it
+        promptString = $"Press {interactKey} to {promptAction}";
+    }
+
+    void OnDisable()
+    {
+        if (InteractionPrompt.HasInstance)
+            InteractionPrompt.Instance.Hide(this);
     }
 
     void Update()
@@ -60,8 +65,12 @@ public class PuzzleInteractable : MonoBehaviour
 
     void CheckPlayerProximity()
     {
+        if (playerTransform == null)
+            playerTransform = RoomContext.Player;
+
         if (playerTransform == null)
         {
+            RoomContext.ReportFallback("Puzzle player");
             GameObject player = GameObject.FindGameObjectWithTag("Player");
             if (player != null)
             {
@@ -85,15 +94,13 @@ public class PuzzleInteractable : MonoBehaviour
 
     void UpdateInteractionPrompt()
     {
-        if (interactionPrompt == null) return;
-
         if (isPlayerInRange && CanInteract())
         {
-            interactionPrompt.SetActive(true);
+            InteractionPrompt.Instance?.Show(this, transform, promptString);
         }
-        else
+        else if (InteractionPrompt.HasInstance)
         {
-            interactionPrompt.SetActive(false);
+            InteractionPrompt.Instance.Hide(this);
         }
     }
 
@@ -186,6 +193,7 @@ public class PuzzleInteractable : MonoBehaviour
         // Mark puzzle as solved
         isPuzzleSolved = true;
         SaveSystem.Instance?.MarkPuzzleSolved(puzzleId);
+        UpdateInteractionPrompt();
 
         // Play sounds
         PlaySound(useItemSound);
@@ -269,13 +277,7 @@ public class PuzzleInteractable : MonoBehaviour
     {
         if (clip == null) return;
 
-        AudioSource audioSource = GetComponent<AudioSource>();
-        if (audioSource == null)
-        {
-            audioSource = gameObject.AddComponent<AudioSource>();
-        }
-
-        audioSource.PlayOneShot(clip);
+        AudioVoiceManager.Instance?.Play(clip, AudioCategory.Interaction);
     }
 
     // Public getters